@@ -1,4 +1,4 @@
-QT       += core gui multimedia
+QT       += core gui multimedia concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -8,28 +8,16 @@ CONFIG += c++17
 # In order to do so, uncomment the following line.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+# Domain, data and controller layers (shared with bhasha_core.pro)
+include(core.pri)
+
+# Application: UI layer plus the pieces that need QtMultimedia
 SOURCES += \
     main.cpp \
     mainwindow.cpp \
-    src/core/controllers/AppController.cpp \
-    src/core/data/ContentRepository.cpp \
     src/core/domain/AudioManager.cpp \
-    src/core/domain/Exercise.cpp \
-    src/core/domain/ExerciseFactory.cpp \
-    src/core/domain/MCQExercise.cpp \
-    src/core/domain/MCQGrader.cpp \
-    src/core/domain/Profile.cpp \
-    src/core/domain/SkillProgress.cpp \
-    src/core/domain/SRSScheduler.cpp \
-    src/core/domain/ExerciseSequence.cpp \
-    src/core/domain/StrategyGrader.cpp \
-    src/core/domain/TileOrderExercise.cpp \
-    src/core/domain/TileOrderGrader.cpp \
-    src/core/domain/TranslateExercise.cpp \
-    src/core/domain/TranslateGrader.cpp \
-    src/core/domain/CharacterUtils.cpp \
-    src/core/domain/CharacterSelectionGrader.cpp \
     src/core/facade/LessonFacade.cpp \
+    src/ui/ExerciseRenderer.cpp \
     src/ui/HomeView.cpp \
     src/ui/LessonView.cpp \
     src/ui/ProfileView.cpp \
@@ -37,26 +25,9 @@ SOURCES += \
 
 HEADERS += \
     mainwindow.h \
-    src/core/controllers/AppController.h \
-    src/core/data/ContentRepository.h \
     src/core/domain/AudioManager.h \
-    src/core/domain/Exercise.h \
-    src/core/domain/ExerciseFactory.h \
-    src/core/domain/MCQExercise.h \
-    src/core/domain/MCQGrader.h \
-    src/core/domain/Profile.h \
-    src/core/domain/Result.h \
-    src/core/domain/SkillProgress.h \
-    src/core/domain/SRSScheduler.h \
-    src/core/domain/ExerciseSequence.h \
-    src/core/domain/StrategyGrader.h \
-    src/core/domain/TileOrderExercise.h \
-    src/core/domain/TileOrderGrader.h \
-    src/core/domain/TranslateExercise.h \
-    src/core/domain/TranslateGrader.h \
-    src/core/domain/CharacterUtils.h \
-    src/core/domain/CharacterSelectionGrader.h \
     src/core/facade/LessonFacade.h \
+    src/ui/ExerciseRenderer.h \
     src/ui/HomeView.h \
     src/ui/LessonView.h \
     src/ui/ProfileView.h \
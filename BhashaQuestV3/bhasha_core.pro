@@ -0,0 +1,11 @@
+# bhasha_core - headless static library (domain, data and controller layers)
+# Links against QtCore and QtConcurrent only, for tools and services that
+# grade, schedule or load content without a GUI.
+
+TEMPLATE = lib
+CONFIG  += staticlib c++17
+QT       = core concurrent
+
+TARGET = bhasha_core
+
+include(core.pri)
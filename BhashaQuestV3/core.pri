@@ -0,0 +1,84 @@
+# Domain, data and controller layers (QtCore only, no Widgets)
+# Included by BhashaQuestV3.pro and by bhasha_core.pro, the static library
+# that headless tools link against.
+
+QT *= core concurrent
+
+INCLUDEPATH += $$PWD/src
+
+SOURCES += \
+    $$PWD/src/core/controllers/AppController.cpp \
+    $$PWD/src/core/data/ContentPack.cpp \
+    $$PWD/src/core/data/ContentRepository.cpp \
+    $$PWD/src/core/data/ContentStreamReader.cpp \
+    $$PWD/src/core/domain/Exercise.cpp \
+    $$PWD/src/core/domain/ExerciseArena.cpp \
+    $$PWD/src/core/domain/ExerciseFactory.cpp \
+    $$PWD/src/core/domain/ExerciseSpec.cpp \
+    $$PWD/src/core/domain/MCQExercise.cpp \
+    $$PWD/src/core/domain/MCQGrader.cpp \
+    $$PWD/src/core/domain/Profile.cpp \
+    $$PWD/src/core/domain/SkillProgress.cpp \
+    $$PWD/src/core/domain/SRSScheduler.cpp \
+    $$PWD/src/core/domain/ExerciseSequence.cpp \
+    $$PWD/src/core/domain/StrategyGrader.cpp \
+    $$PWD/src/core/domain/TileOrderExercise.cpp \
+    $$PWD/src/core/domain/TileOrderGrader.cpp \
+    $$PWD/src/core/domain/TranslateExercise.cpp \
+    $$PWD/src/core/domain/TranslateGrader.cpp \
+    $$PWD/src/core/domain/AnswerPattern.cpp \
+    $$PWD/src/core/domain/AnswerNormalizer.cpp \
+    $$PWD/src/core/domain/AnswerTrie.cpp \
+    $$PWD/src/core/domain/CharacterUtils.cpp \
+    $$PWD/src/core/domain/CharacterSet.cpp \
+    $$PWD/src/core/domain/CharacterSetRegistry.cpp \
+    $$PWD/src/core/domain/CharacterSelectionGrader.cpp \
+    $$PWD/src/core/domain/GraderRegistry.cpp \
+    $$PWD/src/core/domain/GradeCache.cpp \
+    $$PWD/src/core/domain/IncrementalMatcher.cpp \
+    $$PWD/src/core/controllers/LiveAnswerChecker.cpp \
+    $$PWD/src/core/domain/ClusterDistance.cpp \
+    $$PWD/src/core/domain/SchedulingEngine.cpp \
+    $$PWD/src/core/domain/SM2Engine.cpp \
+    $$PWD/src/core/domain/FSRSEngine.cpp \
+    $$PWD/src/core/domain/Clock.cpp
+
+HEADERS += \
+    $$PWD/src/core/controllers/AppController.h \
+    $$PWD/src/core/data/ContentPack.h \
+    $$PWD/src/core/data/ContentRepository.h \
+    $$PWD/src/core/data/ContentSnapshot.h \
+    $$PWD/src/core/data/ContentStreamReader.h \
+    $$PWD/src/core/domain/Exercise.h \
+    $$PWD/src/core/domain/ExerciseArena.h \
+    $$PWD/src/core/domain/ExerciseKind.h \
+    $$PWD/src/core/domain/ExerciseFactory.h \
+    $$PWD/src/core/domain/ExerciseSpec.h \
+    $$PWD/src/core/domain/MCQExercise.h \
+    $$PWD/src/core/domain/MCQGrader.h \
+    $$PWD/src/core/domain/Profile.h \
+    $$PWD/src/core/domain/Result.h \
+    $$PWD/src/core/domain/SkillProgress.h \
+    $$PWD/src/core/domain/SRSScheduler.h \
+    $$PWD/src/core/domain/ExerciseSequence.h \
+    $$PWD/src/core/domain/StrategyGrader.h \
+    $$PWD/src/core/domain/TileOrderExercise.h \
+    $$PWD/src/core/domain/TileOrderGrader.h \
+    $$PWD/src/core/domain/TranslateExercise.h \
+    $$PWD/src/core/domain/TranslateGrader.h \
+    $$PWD/src/core/domain/AnswerPattern.h \
+    $$PWD/src/core/domain/AnswerNormalizer.h \
+    $$PWD/src/core/domain/AnswerTrie.h \
+    $$PWD/src/core/domain/CharacterUtils.h \
+    $$PWD/src/core/domain/CharacterSet.h \
+    $$PWD/src/core/domain/CharacterSetRegistry.h \
+    $$PWD/src/core/domain/CharacterSelectionGrader.h \
+    $$PWD/src/core/domain/GraderRegistry.h \
+    $$PWD/src/core/domain/GradeCache.h \
+    $$PWD/src/core/domain/IncrementalMatcher.h \
+    $$PWD/src/core/controllers/LiveAnswerChecker.h \
+    $$PWD/src/core/domain/ClusterDistance.h \
+    $$PWD/src/core/domain/SchedulingEngine.h \
+    $$PWD/src/core/domain/SM2Engine.h \
+    $$PWD/src/core/domain/FSRSEngine.h \
+    $$PWD/src/core/domain/Clock.h
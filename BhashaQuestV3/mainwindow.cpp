@@ -5,6 +5,8 @@
 #include <QLabel>
 #include <QMessageBox>
 #include <QFont>
+#include <QCoreApplication>
+#include <QDebug>
 
 /**
  * MainWindow Implementation
@@ -179,7 +181,7 @@ void MainWindow::setupUI() {
 
     // Create core components
     // DRY Principle: ContentRepository resolves path automatically
-    contentRepository = new ContentRepository("content.json");
+    contentRepository = new ContentRepository("content.json", this);
     appController = new AppController(this);
     lessonFacade = new LessonFacade(appController, contentRepository, this);
 
@@ -256,9 +258,45 @@ void MainWindow::wireSignalsAndSlots() {
             profileView, &ProfileView::updateStats);
     connect(lessonFacade, &LessonFacade::profileUpdated,
             this, &MainWindow::updateStatusBar);
+
+    // ContentRepository → MainWindow connection for hot reload
+    connect(contentRepository, &ContentRepository::contentReloaded,
+            this, &MainWindow::onContentReloaded);
 }
 
 void MainWindow::loadContent() {
+    // Kiosk deployments build every skill at startup across all cores;
+    // --serial-load keeps the preload on one thread for timing comparisons
+    const QStringList arguments = QCoreApplication::arguments();
+    contentRepository->setPreloadAllSkills(arguments.contains("--preload-content"));
+    contentRepository->setParallelLoading(!arguments.contains("--serial-load"));
+
+    // Repeat answers are graded from a small LRU cache; --no-grade-cache grades every time
+    if (!arguments.contains("--no-grade-cache")) {
+        appController->setGradeCacheCapacity(GradeCache::kDefaultCapacity);
+    }
+
+    // Reviews are scheduled with SM-2 unless --scheduler names another engine
+    const int schedulerArgument = arguments.indexOf("--scheduler");
+    if (schedulerArgument >= 0 && schedulerArgument + 1 < arguments.size()) {
+        QString error;
+        auto engine = SchedulingEngine::create(arguments.at(schedulerArgument + 1), QVector<double>(), &error);
+        if (engine) {
+            appController->getSRSScheduler()->setEngine(engine);
+        } else {
+            qWarning() << "MainWindow:" << error;
+        }
+    }
+
+    // Parameters tuned by tools/srs_optimizer; the file also names the engine
+    const int parametersArgument = arguments.indexOf("--scheduler-params");
+    if (parametersArgument >= 0 && parametersArgument + 1 < arguments.size()) {
+        QString error;
+        if (!appController->getSRSScheduler()->loadEngineParameters(arguments.at(parametersArgument + 1), &error)) {
+            qWarning() << "MainWindow:" << error;
+        }
+    }
+
     // Load exercises from JSON
     if (!contentRepository->loadContent()) {
         QMessageBox::critical(this, "Error", "Failed to load content from content.json");
@@ -268,6 +306,9 @@ void MainWindow::loadContent() {
     // Populate skill selector
     populateSkillSelector();
 
+    // Pick up content edits without a restart
+    contentRepository->setAutoReload(true);
+
     // Initialize profile view with current profile
     profileView->updateProfile(appController->getProfile());
 }
@@ -287,6 +328,7 @@ void MainWindow::populateSkillSelector() {
         startLessonButton->setEnabled(false);
         return;
     }
+    startLessonButton->setEnabled(true);
 
     // Add skills to combo box
     for (const QString& skillId : skills) {
@@ -428,3 +470,21 @@ void MainWindow::updateStatusBar(int xp, int streak) {
         QString("⭐ XP: %1  |  🔥 Streak: %2 days").arg(xp).arg(streak)
     );
 }
+
+void MainWindow::onContentReloaded(const QStringList& changedSkillIds) {
+    // Rebuild the selector but keep whatever the user had picked
+    const QString selectedSkillId = skillSelector->currentData().toString();
+    const QString lessonSkillId = currentSkillId;
+
+    populateSkillSelector();
+
+    const int index = skillSelector->findData(selectedSkillId);
+    if (index > 0) {
+        skillSelector->setCurrentIndex(index);
+    }
+    currentSkillId = lessonSkillId;
+
+    statusBar()->showMessage(
+        QString("🔄 Content updated (%1 skills changed)").arg(changedSkillIds.size())
+    );
+}
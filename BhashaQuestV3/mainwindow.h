@@ -128,5 +128,11 @@ private slots:
      * Shows XP and streak in status bar
      */
     void updateStatusBar(int xp, int streak);
+
+    /**
+     * Handle a hot reload of content.json / content.bqpack
+     * Refreshes the skill selector; a lesson in progress keeps its exercises
+     */
+    void onContentReloaded(const QStringList& changedSkillIds);
 };
 #endif // MAINWINDOW_H
@@ -1,9 +1,5 @@
 #include "AppController.h"
-#include "../domain/MCQGrader.h"
-#include "../domain/TranslateGrader.h"
-#include "../domain/TranslateExercise.h"
-#include "../domain/TileOrderGrader.h"
-#include "../domain/CharacterSelectionGrader.h"
+#include "../domain/GraderRegistry.h"
 #include <QDate>
 #include <QDebug>
 
@@ -22,9 +18,11 @@ AppController::AppController(QObject* parent)
     , sequenceEnd()
     , exercisesServed(0)
     , sessionActive(false)
-    , userProfile(new Profile())
-    , srsScheduler(new SRSScheduler())
+    , clock(QSharedPointer<Clock>::create())
+    , userProfile(new Profile("Player", clock))
+    , srsScheduler(new SRSScheduler(clock))
     , currentGrader(nullptr)
+    , gradeCache(nullptr)
     , currentSkillId("")
     , sessionsCompletedToday(0)
     , sessionXP(0)  // Track XP for current session
@@ -39,6 +37,7 @@ AppController::~AppController() {
     // Clean up domain objects
     delete userProfile;
     delete srsScheduler;
+    delete gradeCache;
 }
 
 // ========== Session Management ==========
@@ -116,11 +115,11 @@ bool AppController::loadNextExercise() {
     ++sequenceIterator;
     exercisesServed = sequenceIterator.position();
 
-    // Create appropriate grader for this exercise
-    currentGrader = createGraderForExercise(currentExercise);
+    // Borrow the shared grader for this exercise type (Strategy Pattern)
+    currentGrader = GraderRegistry::getInstance().graderFor(currentExercise);
 
     if (!currentGrader) {
-        qDebug() << "Error: Failed to create grader for exercise type" << currentExercise->getType();
+        qDebug() << "Error: No grader for exercise type" << currentExercise->getType();
         return false;
     }
 
@@ -168,11 +167,34 @@ Result AppController::gradeAnswer(const QString& userAnswer) {
         return Result(false, 0, "No active exercise");
     }
 
+    // Repeated answers come from the cache when it is enabled
+    if (gradeCache) {
+        return gradeCache->grade(currentGrader, userAnswer, currentExercise);
+    }
+
     // Delegate grading to appropriate strategy
     // This is the Strategy Pattern in action
     return currentGrader->grade(userAnswer, currentExercise);
 }
 
+void AppController::setGradeCacheCapacity(int capacity) {
+    if (capacity <= 0) {
+        delete gradeCache;
+        gradeCache = nullptr;
+        return;
+    }
+
+    if (gradeCache) {
+        gradeCache->setCapacity(capacity);
+    } else {
+        gradeCache = new GradeCache(capacity);
+    }
+}
+
+GradeCache* AppController::getGradeCache() const {
+    return gradeCache;
+}
+
 // ========== Profile and Progress Management ==========
 
 void AppController::updateProfile(const Result& result) {
@@ -224,6 +246,13 @@ void AppController::setProfile(Profile* profile) {
         delete userProfile;
     }
     userProfile = profile;
+    if (userProfile) {
+        userProfile->setClock(clock);
+    }
+}
+
+QSharedPointer<Clock> AppController::getClock() const {
+    return clock;
 }
 
 // ========== SRS Integration ==========
@@ -254,7 +283,7 @@ void AppController::reset() {
     // Reset profile (optional - could keep progress)
     if (userProfile) {
         delete userProfile;
-        userProfile = new Profile();
+        userProfile = new Profile("Player", clock);
     }
 
     sessionsCompletedToday = 0;
@@ -262,33 +291,6 @@ void AppController::reset() {
 
 // ========== Private Helper Methods ==========
 
-StrategyGrader* AppController::createGraderForExercise(Exercise* exercise) {
-    if (!exercise) {
-        qDebug() << "Error: Cannot create grader for null exercise";
-        return nullptr;
-    }
-
-    // DESIGN PATTERN: Strategy Pattern
-    // Create appropriate grader based on exercise type
-    QString type = exercise->getType();
-
-    if (type == "MCQ") {
-        return new MCQGrader();
-    } else if (type == "Translate") {
-        TranslateExercise* translateExercise = dynamic_cast<TranslateExercise*>(exercise);
-        if (translateExercise && translateExercise->usesCharacterSelection()) {
-            return new CharacterSelectionGrader();
-        }
-        return new TranslateGrader();
-    } else if (type == "TileOrder") {
-        return new TileOrderGrader();
-    }
-
-    // Log unknown exercise type
-    qDebug() << "Warning: Unknown exercise type:" << type;
-    return nullptr;
-}
-
 int AppController::calculateXP(const Result& result) const {
     if (!result.correct || !currentExercise) {
         return 0;
@@ -321,9 +323,6 @@ void AppController::cleanupCurrentExercise() {
     // We just clear the pointer
     currentExercise = nullptr;
 
-    // Delete the current grader (we own this)
-    if (currentGrader) {
-        delete currentGrader;
-        currentGrader = nullptr;
-    }
+    // The grader is shared through GraderRegistry: just drop the reference
+    currentGrader = nullptr;
 }
@@ -6,6 +6,7 @@
 #include <QSharedPointer>
 #include "../domain/Exercise.h"
 #include "../domain/StrategyGrader.h"
+#include "../domain/GradeCache.h"
 #include "../domain/Profile.h"
 #include "../domain/SRSScheduler.h"
 #include "../domain/Result.h"
@@ -49,9 +50,11 @@ private:
     bool sessionActive;                                            // Tracks whether a session is in progress
 
     // Domain objects
+    QSharedPointer<Clock> clock;            // "Today" for Profile and SRSScheduler (time travel)
     Profile* userProfile;                   // User profile and progress
     SRSScheduler* srsScheduler;             // Spaced repetition scheduler
-    StrategyGrader* currentGrader;          // Grader for current exercise type
+    const StrategyGrader* currentGrader;    // Shared grader for current exercise type (GraderRegistry)
+    GradeCache* gradeCache;                 // Memoized outcomes (owned), nullptr when disabled
 
     // Session metadata
     QString currentSkillId;                 // Current skill being practiced
@@ -114,6 +117,18 @@ public:
      */
     Result gradeAnswer(const QString& userAnswer);
 
+    /**
+     * Put a bounded LRU GradeCache in front of the graders
+     * Repeated answers to an exercise are then answered from the cache.
+     * @param capacity - Maximum cached outcomes; 0 disables and frees the cache
+     */
+    void setGradeCacheCapacity(int capacity);
+
+    /**
+     * @return The grade cache (hit/miss counters, invalidation), or nullptr if disabled
+     */
+    GradeCache* getGradeCache() const;
+
     // Profile and progress management
 
     /**
@@ -135,6 +150,11 @@ public:
      */
     void setProfile(Profile* profile);
 
+    /**
+     * Clock shared by the profile and the SRS scheduler
+     */
+    QSharedPointer<Clock> getClock() const;
+
     // SRS integration
 
     /**
@@ -198,14 +218,6 @@ signals:
     void progressUpdated(int current, int total);
 
 private:
-    /**
-     * Select and instantiate appropriate grader for exercise type
-     * Uses Strategy Pattern - creates MCQGrader, TranslateGrader, or TileOrderGrader
-     * @param exercise - The exercise to grade
-     * @return Pointer to appropriate grader (caller must delete)
-     */
-    StrategyGrader* createGraderForExercise(Exercise* exercise);
-
     /**
      * Calculate XP earned based on result and exercise difficulty
      * @param result - The grading result
@@ -214,8 +226,8 @@ private:
     int calculateXP(const Result& result) const;
 
     /**
-     * Clean up current exercise and grader
-     * Deletes allocated memory
+     * Clear the current exercise and grader
+     * Neither is owned: exercises belong to ContentRepository, graders to GraderRegistry
      */
     void cleanupCurrentExercise();
 };
@@ -0,0 +1,103 @@
+#include "LiveAnswerChecker.h"
+#include "../domain/TranslateGrader.h"
+#include <QTimer>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrent>
+
+LiveAnswerChecker::LiveAnswerChecker(QObject* parent)
+    : QObject(parent)
+    , debounceTimer(new QTimer(this))
+    , watcher(new QFutureWatcher<IncrementalMatcher::Match>(this))
+    , inputPending(false)
+    , lastMatch(IncrementalMatcher::NoMatch)
+{
+    debounceTimer->setSingleShot(true);
+    debounceTimer->setInterval(kDefaultDebounceMs);
+    connect(debounceTimer, &QTimer::timeout, this, &LiveAnswerChecker::onDebounceTimeout);
+    connect(watcher, &QFutureWatcher<IncrementalMatcher::Match>::finished,
+            this, &LiveAnswerChecker::onCheckFinished);
+}
+
+LiveAnswerChecker::~LiveAnswerChecker() {
+    // The running check holds its own reference to the matcher; just wait for it
+    watcher->waitForFinished();
+}
+
+void LiveAnswerChecker::setExercise(const TranslateExercise* exercise) {
+    debounceTimer->stop();
+    inputPending = false;
+    pendingInput.clear();
+
+    // A fresh matcher per exercise: a check still running on the old one
+    // finishes on its own copy and its result is ignored
+    if (exercise && !exercise->getAnswerTrie().isEmpty()) {
+        matcher = QSharedPointer<IncrementalMatcher>::create(exercise->getAnswerTrie(),
+                                                             TranslateGrader::kMaxTypos);
+    } else {
+        matcher.reset();
+    }
+
+    if (lastMatch != IncrementalMatcher::NoMatch) {
+        lastMatch = IncrementalMatcher::NoMatch;
+        emit matchChanged(lastMatch);
+    }
+}
+
+void LiveAnswerChecker::setDebounceInterval(int milliseconds) {
+    debounceTimer->setInterval(milliseconds);
+}
+
+IncrementalMatcher::Match LiveAnswerChecker::currentMatch() const {
+    return lastMatch;
+}
+
+// ========== Checking ==========
+
+void LiveAnswerChecker::updateInput(const QString& text) {
+    if (!matcher) {
+        return;
+    }
+    pendingInput = text;
+    inputPending = true;
+    debounceTimer->start();     // Restarts while keys keep coming
+}
+
+void LiveAnswerChecker::onDebounceTimeout() {
+    // The matcher is not thread-safe: never run two checks on it at once
+    if (watcher->isRunning() && runningMatcher == matcher) {
+        return;     // onCheckFinished() picks the pending text up
+    }
+    startCheck();
+}
+
+void LiveAnswerChecker::startCheck() {
+    if (!matcher || !inputPending) {
+        return;
+    }
+    inputPending = false;
+
+    runningMatcher = matcher;
+    QSharedPointer<IncrementalMatcher> target = matcher;
+    const QString text = pendingInput;
+    watcher->setFuture(QtConcurrent::run([target, text]() {
+        return target->update(text);
+    }));
+}
+
+void LiveAnswerChecker::onCheckFinished() {
+    const bool current = (runningMatcher == matcher);
+    runningMatcher.reset();
+
+    if (current && !inputPending) {
+        const IncrementalMatcher::Match match = watcher->result();
+        if (match != lastMatch) {
+            lastMatch = match;
+            emit matchChanged(lastMatch);
+        }
+    }
+
+    // Text typed while the check ran, once the user has paused
+    if (inputPending && !debounceTimer->isActive()) {
+        startCheck();
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef LIVEANSWERCHECKER_H
+#define LIVEANSWERCHECKER_H
+
+#include <QObject>
+#include <QString>
+#include <QSharedPointer>
+#include "../domain/IncrementalMatcher.h"
+#include "../domain/TranslateExercise.h"
+
+class QTimer;
+template <typename T> class QFutureWatcher;
+
+/**
+ * LiveAnswerChecker - As-you-type match hint for Translate answers
+ *
+ * ARCHITECTURE: Controller Layer
+ * Purpose: Tell the learner while typing whether the text is on track, close
+ * (would be accepted) or exact, without making the input field lag.
+ *
+ * - Keystrokes restart a short single-shot timer, so a burst of typing is
+ *   checked once, after it pauses
+ * - The check runs on QThreadPool::globalInstance() through QtConcurrent and
+ *   reports back through a QFutureWatcher on the GUI thread
+ * - At most one check runs at a time; text typed meanwhile is checked as soon
+ *   as it finishes
+ * - IncrementalMatcher keeps the DP state between checks, so each check only
+ *   pays for the characters that changed
+ *
+ * Usage: checker->setExercise(translateExercise);
+ *        connect(lineEdit, &QLineEdit::textChanged, checker, &LiveAnswerChecker::updateInput);
+ *        connect(checker, &LiveAnswerChecker::matchChanged, view, ...);
+ */
+class LiveAnswerChecker : public QObject {
+    Q_OBJECT
+
+public:
+    static const int kDefaultDebounceMs = 120;
+
+    explicit LiveAnswerChecker(QObject* parent = nullptr);
+    ~LiveAnswerChecker();
+
+    /**
+     * Check input against a new exercise's answers
+     * @param exercise - nullptr stops checking (results of running checks are dropped)
+     */
+    void setExercise(const TranslateExercise* exercise);
+
+    /**
+     * Quiet time after the last keystroke before checking
+     */
+    void setDebounceInterval(int milliseconds);
+
+    IncrementalMatcher::Match currentMatch() const;
+
+public slots:
+    /**
+     * Latest text of the input field (connect to QLineEdit::textChanged)
+     */
+    void updateInput(const QString& text);
+
+signals:
+    /**
+     * The hint for the current text changed
+     */
+    void matchChanged(IncrementalMatcher::Match match);
+
+private slots:
+    void onDebounceTimeout();
+    void onCheckFinished();
+
+private:
+    void startCheck();
+
+    QTimer* debounceTimer;
+    QFutureWatcher<IncrementalMatcher::Match>* watcher;
+    QSharedPointer<IncrementalMatcher> matcher;         // Null when no exercise is set
+    QSharedPointer<IncrementalMatcher> runningMatcher;  // Matcher of the check in flight
+    QString pendingInput;                               // Latest text, not checked yet
+    bool inputPending;
+    IncrementalMatcher::Match lastMatch;
+};
+
+#endif // LIVEANSWERCHECKER_H
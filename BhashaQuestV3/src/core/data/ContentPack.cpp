@@ -0,0 +1,461 @@
+#include "ContentPack.h"
+#include "ContentStreamReader.h"
+#include "../domain/ExerciseKind.h"
+#include <QSaveFile>
+#include <QHash>
+#include <QVector>
+#include <QDebug>
+#include <cstring>
+
+/**
+ * ContentPack Implementation
+ *
+ * Reader: maps the file once and hands out views into it.
+ * Writer: used by the offline content compiler (tools/content_compiler).
+ */
+
+static_assert(sizeof(ContentPack::StringRef) == 8, "StringRef must stay 8 bytes");
+static_assert(sizeof(ContentPack::ListRef) == 8, "ListRef must stay 8 bytes");
+static_assert(sizeof(ContentPack::Header) == 48, "Header layout changed - bump kFormatVersion");
+static_assert(sizeof(ContentPack::SkillRecord) == 60, "SkillRecord layout changed - bump kFormatVersion");
+static_assert(sizeof(ContentPack::ExerciseRecord) == 72, "ExerciseRecord layout changed - bump kFormatVersion");
+
+namespace {
+
+void setError(QString* errorMessage, const QString& message) {
+    if (errorMessage) {
+        *errorMessage = message;
+    }
+}
+
+/**
+ * PackBuilder - Accumulates tables in memory and serializes them in one go
+ */
+class PackBuilder {
+public:
+    ContentPack::StringRef intern(const QString& text) {
+        ContentPack::StringRef ref = {0, 0};
+        if (text.isEmpty()) {
+            return ref;
+        }
+
+        auto it = internedStrings.constFind(text);
+        if (it != internedStrings.constEnd()) {
+            return it.value();
+        }
+
+        ref.offset = static_cast<quint32>(stringPool.size());
+        ref.length = static_cast<quint32>(text.size());
+        const char16_t* units = reinterpret_cast<const char16_t*>(text.utf16());
+        for (int i = 0; i < text.size(); ++i) {
+            stringPool.append(units[i]);
+        }
+        internedStrings.insert(text, ref);
+        return ref;
+    }
+
+    ContentPack::ListRef list(const QStringList& items) {
+        ContentPack::ListRef ref;
+        ref.first = static_cast<quint32>(listEntries.size());
+        ref.count = static_cast<quint32>(items.size());
+        for (const QString& item : items) {
+            listEntries.append(intern(item));
+        }
+        return ref;
+    }
+
+    bool addExercise(const ExerciseSpec& spec) {
+        ContentPack::ExerciseRecord record;
+        std::memset(&record, 0, sizeof(record));
+
+        switch (exerciseKindFromType(spec.type)) {
+            case ExerciseKind::MCQ:
+                record.kind = ContentPack::KindMCQ;
+                record.primary = list(spec.options);
+                break;
+            case ExerciseKind::Translate:
+                record.kind = ContentPack::KindTranslate;
+                record.primary = list(spec.correctAnswers);
+                break;
+            case ExerciseKind::TileOrder:
+                record.kind = ContentPack::KindTileOrder;
+                record.primary = list(spec.tiles);
+                record.secondary = list(spec.correctOrder);
+                break;
+            case ExerciseKind::Unknown:
+                return false;
+        }
+
+        record.flags = spec.shuffled ? ContentPack::FlagShuffled : 0;
+        record.difficulty = static_cast<quint16>(qMax(0, spec.difficulty));
+        record.correctIndex = spec.correctIndex;
+        record.id = intern(spec.id);
+        record.prompt = intern(spec.prompt);
+        record.skillId = intern(spec.skillId);
+        record.audioFile = intern(spec.audioFile);
+        record.englishPhrase = intern(spec.englishPhrase);
+        record.targetLanguage = intern(spec.targetLanguage);
+
+        exercises.append(record);
+        return true;
+    }
+
+    QByteArray serialize() const {
+        ContentPack::Header header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = ContentPack::kMagic;
+        header.byteOrderMark = ContentPack::kByteOrderMark;
+        header.version = ContentPack::kFormatVersion;
+        header.skillCount = static_cast<quint32>(skills.size());
+        header.exerciseCount = static_cast<quint32>(exercises.size());
+        header.listEntryCount = static_cast<quint32>(listEntries.size());
+        header.stringPoolLength = static_cast<quint32>(stringPool.size());
+
+        quint32 offset = sizeof(ContentPack::Header);
+        header.skillTableOffset = offset;
+        offset += skills.size() * sizeof(ContentPack::SkillRecord);
+        header.exerciseTableOffset = offset;
+        offset += exercises.size() * sizeof(ContentPack::ExerciseRecord);
+        header.listTableOffset = offset;
+        offset += listEntries.size() * sizeof(ContentPack::StringRef);
+        header.stringPoolOffset = offset;
+        offset += stringPool.size() * sizeof(char16_t);
+        header.fileSize = offset;
+
+        QByteArray bytes;
+        bytes.reserve(offset);
+        bytes.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        bytes.append(reinterpret_cast<const char*>(skills.constData()),
+                     skills.size() * sizeof(ContentPack::SkillRecord));
+        bytes.append(reinterpret_cast<const char*>(exercises.constData()),
+                     exercises.size() * sizeof(ContentPack::ExerciseRecord));
+        bytes.append(reinterpret_cast<const char*>(listEntries.constData()),
+                     listEntries.size() * sizeof(ContentPack::StringRef));
+        bytes.append(reinterpret_cast<const char*>(stringPool.constData()),
+                     stringPool.size() * sizeof(char16_t));
+        return bytes;
+    }
+
+    QVector<ContentPack::SkillRecord> skills;
+    QVector<ContentPack::ExerciseRecord> exercises;
+
+private:
+    QHash<QString, ContentPack::StringRef> internedStrings;
+    QVector<ContentPack::StringRef> listEntries;
+    QVector<char16_t> stringPool;
+};
+
+} // namespace
+
+ContentPack::ContentPack()
+    : data(nullptr)
+    , size(0)
+    , header(nullptr)
+    , skills(nullptr)
+    , exercises(nullptr)
+    , listEntries(nullptr)
+    , stringPool(nullptr)
+{
+}
+
+ContentPack::~ContentPack() {
+    close();
+}
+
+// ========== Reading ==========
+
+bool ContentPack::open(const QString& path, QString* errorMessage) {
+    close();
+
+    file.setFileName(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        setError(errorMessage, QString("Cannot open %1").arg(path));
+        return false;
+    }
+
+    size = file.size();
+    if (size < static_cast<qint64>(sizeof(Header))) {
+        setError(errorMessage, QString("%1 is too small to be a content pack").arg(path));
+        close();
+        return false;
+    }
+
+    data = file.map(0, size);
+    if (!data) {
+        setError(errorMessage, QString("Cannot map %1").arg(path));
+        close();
+        return false;
+    }
+
+    header = reinterpret_cast<const Header*>(data);
+    if (!validate(errorMessage)) {
+        close();
+        return false;
+    }
+
+    skills = reinterpret_cast<const SkillRecord*>(data + header->skillTableOffset);
+    exercises = reinterpret_cast<const ExerciseRecord*>(data + header->exerciseTableOffset);
+    listEntries = reinterpret_cast<const StringRef*>(data + header->listTableOffset);
+    stringPool = reinterpret_cast<const char16_t*>(data + header->stringPoolOffset);
+
+    // Every reference is checked once here so the accessors can stay branch-free
+    for (quint32 i = 0; i < header->listEntryCount; ++i) {
+        if (!isValidString(listEntries[i])) {
+            setError(errorMessage, "List table references text outside the string pool");
+            close();
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < header->skillCount; ++i) {
+        const SkillRecord& record = skills[i];
+        if (!isValidString(record.id) || !isValidString(record.name)
+            || !isValidString(record.language) || !isValidList(record.characterSet)
+            || record.firstExercise > header->exerciseCount
+            || record.exerciseCount > header->exerciseCount - record.firstExercise) {
+            setError(errorMessage, QString("Skill record %1 is out of bounds").arg(i));
+            close();
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < header->exerciseCount; ++i) {
+        const ExerciseRecord& record = exercises[i];
+        if (record.kind < KindMCQ || record.kind > KindTileOrder
+            || !isValidString(record.id) || !isValidString(record.prompt)
+            || !isValidString(record.skillId) || !isValidString(record.audioFile)
+            || !isValidString(record.englishPhrase) || !isValidString(record.targetLanguage)
+            || !isValidList(record.primary) || !isValidList(record.secondary)) {
+            setError(errorMessage, QString("Exercise record %1 is out of bounds").arg(i));
+            close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ContentPack::close() {
+    if (data) {
+        file.unmap(const_cast<uchar*>(data));
+    }
+    if (file.isOpen()) {
+        file.close();
+    }
+
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    skills = nullptr;
+    exercises = nullptr;
+    listEntries = nullptr;
+    stringPool = nullptr;
+}
+
+bool ContentPack::validate(QString* errorMessage) const {
+    if (header->magic != kMagic) {
+        setError(errorMessage, "Not a BhashaQuest content pack");
+        return false;
+    }
+    if (header->byteOrderMark != kByteOrderMark) {
+        setError(errorMessage, "Content pack was compiled for a different byte order");
+        return false;
+    }
+    if (header->version != kFormatVersion) {
+        setError(errorMessage, QString("Unsupported content pack version %1 (expected %2)")
+                 .arg(header->version).arg(kFormatVersion));
+        return false;
+    }
+    if (static_cast<qint64>(header->fileSize) != size) {
+        setError(errorMessage, "Content pack is truncated");
+        return false;
+    }
+
+    const quint64 fileSize = static_cast<quint64>(size);
+    const quint64 skillEnd = quint64(header->skillTableOffset)
+                           + quint64(header->skillCount) * sizeof(SkillRecord);
+    const quint64 exerciseEnd = quint64(header->exerciseTableOffset)
+                              + quint64(header->exerciseCount) * sizeof(ExerciseRecord);
+    const quint64 listEnd = quint64(header->listTableOffset)
+                          + quint64(header->listEntryCount) * sizeof(StringRef);
+    const quint64 poolEnd = quint64(header->stringPoolOffset)
+                          + quint64(header->stringPoolLength) * sizeof(char16_t);
+
+    if (skillEnd > fileSize || exerciseEnd > fileSize || listEnd > fileSize || poolEnd > fileSize
+        || header->skillTableOffset % 4 != 0 || header->exerciseTableOffset % 4 != 0
+        || header->listTableOffset % 4 != 0 || header->stringPoolOffset % 2 != 0) {
+        setError(errorMessage, "Content pack tables are out of bounds");
+        return false;
+    }
+
+    return true;
+}
+
+bool ContentPack::isValidString(const StringRef& ref) const {
+    return ref.offset <= header->stringPoolLength
+        && ref.length <= header->stringPoolLength - ref.offset;
+}
+
+bool ContentPack::isValidList(const ListRef& ref) const {
+    return ref.first <= header->listEntryCount
+        && ref.count <= header->listEntryCount - ref.first;
+}
+
+int ContentPack::skillCount() const {
+    return header ? static_cast<int>(header->skillCount) : 0;
+}
+
+int ContentPack::exerciseCount() const {
+    return header ? static_cast<int>(header->exerciseCount) : 0;
+}
+
+const ContentPack::SkillRecord& ContentPack::skill(int index) const {
+    return skills[index];
+}
+
+const ContentPack::ExerciseRecord& ContentPack::exercise(int index) const {
+    return exercises[index];
+}
+
+QStringView ContentPack::stringView(const StringRef& ref) const {
+    return QStringView(stringPool + ref.offset, static_cast<qsizetype>(ref.length));
+}
+
+QString ContentPack::string(const StringRef& ref) const {
+    if (ref.length == 0) {
+        return QString();
+    }
+    return QString::fromRawData(reinterpret_cast<const QChar*>(stringPool + ref.offset),
+                                static_cast<qsizetype>(ref.length));
+}
+
+QStringList ContentPack::stringList(const ListRef& ref) const {
+    QStringList list;
+    list.reserve(ref.count);
+    for (quint32 i = 0; i < ref.count; ++i) {
+        list.append(string(listEntries[ref.first + i]));
+    }
+    return list;
+}
+
+QByteArray ContentPack::contentHash(const SkillRecord& record) {
+    return QByteArray(reinterpret_cast<const char*>(record.contentHash), sizeof(record.contentHash));
+}
+
+ExerciseSpec ContentPack::exerciseSpec(int index) const {
+    const ExerciseRecord& record = exercises[index];
+    ExerciseSpec spec;
+
+    switch (record.kind) {
+        case KindMCQ:
+            spec.type = QStringLiteral("MCQ");
+            spec.options = stringList(record.primary);
+            break;
+        case KindTranslate:
+            spec.type = QStringLiteral("Translate");
+            spec.correctAnswers = stringList(record.primary);
+            break;
+        case KindTileOrder:
+            spec.type = QStringLiteral("TileOrder");
+            spec.tiles = stringList(record.primary);
+            spec.correctOrder = stringList(record.secondary);
+            break;
+        default:
+            break;
+    }
+
+    // Ids outlive the snapshot (SRS schedule, grade cache keys), so they are copied;
+    // a copy of a fromRawData string would still point into the mapping
+    spec.id = stringView(record.id).toString();
+    spec.prompt = string(record.prompt);
+    spec.skillId = stringView(record.skillId).toString();
+    spec.audioFile = string(record.audioFile);
+    spec.englishPhrase = string(record.englishPhrase);
+    spec.targetLanguage = string(record.targetLanguage);
+    spec.difficulty = record.difficulty;
+    spec.correctIndex = record.correctIndex;
+    spec.shuffled = (record.flags & FlagShuffled) != 0;
+    return spec;
+}
+
+// ========== Compiling ==========
+
+bool ContentPack::compile(const QString& jsonPath, const QString& packPath, QString* errorMessage) {
+    QFile input(jsonPath);
+    if (!input.open(QIODevice::ReadOnly)) {
+        setError(errorMessage, QString("Cannot open %1").arg(jsonPath));
+        return false;
+    }
+
+    /**
+     * Feeds streamed exercises straight into the builder and closes each skill
+     * record when its object ends. Same acceptance rules as ContentRepository's
+     * JSON loader, so both paths expose identical content.
+     */
+    class CompileHandler : public ContentStreamReader::Handler {
+    public:
+        explicit CompileHandler(PackBuilder& builder)
+            : builder(builder), firstExercise(0) {}
+
+        void exercise(const ExerciseSpec& spec) override {
+            if (!builder.addExercise(spec)) {
+                qWarning() << "ContentPack: Skipping exercise" << spec.id
+                           << "with unknown type" << spec.type;
+            }
+        }
+
+        void skill(const ContentStreamReader::SkillInfo& info) override {
+            const quint32 exerciseCount = static_cast<quint32>(builder.exercises.size()) - firstExercise;
+
+            if (info.id.isEmpty() || !info.hasExercises || exerciseCount == 0) {
+                if (info.id.isEmpty() || !info.hasExercises) {
+                    qWarning() << "ContentPack: Skipping skill without id or exercises";
+                }
+                // Roll back the exercises of the rejected skill
+                builder.exercises.resize(static_cast<int>(firstExercise));
+                return;
+            }
+
+            SkillRecord record;
+            std::memset(&record, 0, sizeof(record));
+            record.firstExercise = firstExercise;
+            record.exerciseCount = exerciseCount;
+            record.id = builder.intern(info.id);
+            record.name = builder.intern(info.name);
+            record.language = builder.intern(info.language);
+            record.characterSet = builder.list(info.characterSet);
+            std::memcpy(record.contentHash, info.contentHash.constData(),
+                        qMin(info.contentHash.size(), int(sizeof(record.contentHash))));
+            builder.skills.append(record);
+
+            firstExercise = static_cast<quint32>(builder.exercises.size());
+        }
+
+    private:
+        PackBuilder& builder;
+        quint32 firstExercise;      // First exercise of the skill being read
+    };
+
+    PackBuilder builder;
+    CompileHandler handler(builder);
+    ContentStreamReader reader(&input);
+    const bool ok = reader.readDocument(&handler);
+    input.close();
+
+    if (!ok) {
+        setError(errorMessage, QString("Invalid JSON in %1: %2").arg(jsonPath, reader.errorString()));
+        return false;
+    }
+
+    QSaveFile output(packPath);
+    if (!output.open(QIODevice::WriteOnly)) {
+        setError(errorMessage, QString("Cannot write %1").arg(packPath));
+        return false;
+    }
+
+    output.write(builder.serialize());
+    if (!output.commit()) {
+        setError(errorMessage, QString("Failed to save %1").arg(packPath));
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,160 @@
+#ifndef CONTENTPACK_H
+#define CONTENTPACK_H
+
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <QFile>
+#include "../domain/ExerciseSpec.h"
+
+/**
+ * ContentPack - Precompiled binary form of content.json, read through mmap
+ *
+ * ARCHITECTURE: Data Layer
+ * Purpose: Fast cold start. The pack is produced offline by the content compiler
+ * (tools/content_compiler) and memory-mapped by ContentRepository at startup.
+ *
+ * File layout (host byte order, every section 4-byte aligned):
+ *   Header
+ *   SkillRecord[skillCount]
+ *   ExerciseRecord[exerciseCount]
+ *   StringRef[listEntryCount]      - list table (options, answers, tiles, ...)
+ *   char16_t[stringPoolLength]     - UTF-16 string pool, identical strings stored once
+ *
+ * Strings returned by string()/stringList() point straight into the mapping
+ * (QString::fromRawData), so no text is copied. The pack must stay open for as long
+ * as any of those strings or the exercises built from them are alive. Exercise
+ * and skill ids in exerciseSpec() are the exception: they are copied out.
+ */
+class ContentPack {
+public:
+    static constexpr quint32 kMagic = 0x4B505142;       // "BQPK"
+    static constexpr quint32 kByteOrderMark = 0x01020304;
+    static constexpr quint32 kFormatVersion = 2;
+    static constexpr int kContentHashSize = 20;          // SHA-1
+
+    enum ExerciseKind : quint8 {
+        KindMCQ = 1,
+        KindTranslate = 2,
+        KindTileOrder = 3
+    };
+
+    enum ExerciseFlags : quint8 {
+        FlagShuffled = 0x01
+    };
+
+    struct StringRef {
+        quint32 offset;             // In UTF-16 units from the start of the pool
+        quint32 length;             // In UTF-16 units
+    };
+
+    struct ListRef {
+        quint32 first;              // Index of the first entry in the list table
+        quint32 count;
+    };
+
+    struct Header {
+        quint32 magic;
+        quint32 byteOrderMark;
+        quint32 version;
+        quint32 fileSize;
+        quint32 skillCount;
+        quint32 exerciseCount;
+        quint32 listEntryCount;
+        quint32 stringPoolLength;
+        quint32 skillTableOffset;   // Byte offsets from the start of the file
+        quint32 exerciseTableOffset;
+        quint32 listTableOffset;
+        quint32 stringPoolOffset;
+    };
+
+    struct SkillRecord {
+        StringRef id;
+        StringRef name;
+        StringRef language;
+        ListRef characterSet;
+        quint32 firstExercise;      // Index into the exercise table
+        quint32 exerciseCount;
+        quint8 contentHash[kContentHashSize];   // Hash of the skill's JSON source, for hot reload
+    };
+
+    struct ExerciseRecord {
+        quint8 kind;                // ExerciseKind
+        quint8 flags;               // ExerciseFlags
+        quint16 difficulty;         // 0 = type default
+        qint32 correctIndex;        // MCQ only
+        StringRef id;
+        StringRef prompt;
+        StringRef skillId;
+        StringRef audioFile;
+        StringRef englishPhrase;    // Translate only
+        StringRef targetLanguage;   // Translate only
+        ListRef primary;            // MCQ options / Translate answers / TileOrder tiles
+        ListRef secondary;          // TileOrder correct order
+    };
+
+    ContentPack();
+    ~ContentPack();
+
+    ContentPack(const ContentPack&) = delete;
+    ContentPack& operator=(const ContentPack&) = delete;
+
+    /**
+     * Map and validate a pack file
+     * @param path - Pack file to open
+     * @param errorMessage - Optional reason on failure
+     * @return true if the pack is mapped and all tables are in bounds
+     */
+    bool open(const QString& path, QString* errorMessage = nullptr);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    int skillCount() const;
+    int exerciseCount() const;
+    const SkillRecord& skill(int index) const;
+    const ExerciseRecord& exercise(int index) const;
+
+    /**
+     * Zero-copy accessors into the string pool
+     */
+    QStringView stringView(const StringRef& ref) const;
+    QString string(const StringRef& ref) const;
+    QStringList stringList(const ListRef& ref) const;
+
+    /**
+     * Content hash of a skill record (same value the JSON loader computes)
+     */
+    static QByteArray contentHash(const SkillRecord& record);
+
+    /**
+     * Describe one exercise record as an ExerciseSpec for ExerciseFactory
+     * id and skillId are owned copies, since they are kept after the pack
+     * closes; all other strings reference the mapping (no copies)
+     */
+    ExerciseSpec exerciseSpec(int index) const;
+
+    /**
+     * Offline compiler entry point: convert content.json into a pack file
+     * The output is written atomically (QSaveFile), so a running app that has
+     * the old pack mapped keeps a valid view of it.
+     * @return true on success; errorMessage describes the failure otherwise
+     */
+    static bool compile(const QString& jsonPath, const QString& packPath,
+                        QString* errorMessage = nullptr);
+
+private:
+    bool validate(QString* errorMessage) const;
+    bool isValidString(const StringRef& ref) const;
+    bool isValidList(const ListRef& ref) const;
+
+    QFile file;
+    const uchar* data;
+    qint64 size;
+    const Header* header;
+    const SkillRecord* skills;
+    const ExerciseRecord* exercises;
+    const StringRef* listEntries;
+    const char16_t* stringPool;
+};
+
+#endif // CONTENTPACK_H
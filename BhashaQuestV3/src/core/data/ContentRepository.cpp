@@ -1,254 +1,678 @@
 #include "ContentRepository.h"
 #include "../domain/ExerciseFactory.h"
 #include "../domain/TranslateExercise.h"
+#include "../domain/CharacterSetRegistry.h"
+#include "ContentStreamReader.h"
 #include <QFile>
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QJsonArray>
 #include <QDebug>
 #include <QCoreApplication>
 #include <QDir>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QFileSystemWatcher>
+#include <QTimer>
+#include <QtConcurrent>
 
 /**
  * ContentRepository Implementation
  *
- * This file implements the data layer for loading exercises from JSON.
+ * This file implements the data layer for loading exercises from the binary
+ * content pack or from JSON.
  * Uses ExerciseFactory (Factory Pattern) to create Exercise instances.
  */
 
-ContentRepository::ContentRepository(const QString& contentFileName)
-    : contentLoaded(false)
+namespace {
+
+// Editors and the content compiler write in several steps; wait for quiet
+const int kReloadDebounceMs = 300;
+
+} // namespace
+
+ContentRepository::ContentRepository(const QString& contentFileName, QObject* parent)
+    : QObject(parent)
+    , snapshot(ContentSnapshotPtr::create())
+    , contentLoaded(false)
+    , preloadSkills(false)
+    , parallelLoading(true)
+    , lastLoadTimeMs(0.0)
+    , nextGeneration(1)
+    , watcher(nullptr)
+    , reloadTimer(nullptr)
 {
     // KISS Principle: Simple path resolution using Qt's built-in functionality
     // Build absolute path to content file in application directory
     QString appDir = QCoreApplication::applicationDirPath();
     contentFilePath = QDir(appDir).filePath(contentFileName);
 
+    // The offline content compiler writes <name>.bqpack next to <name>.json
+    QFileInfo contentInfo(contentFilePath);
+    packFilePath = contentInfo.dir().filePath(contentInfo.completeBaseName() + ".bqpack");
+
     qDebug() << "ContentRepository: Resolved content path to" << contentFilePath;
 }
 
 ContentRepository::~ContentRepository() {
-    clearContent();
+    // Exercises live in the snapshots; ours is released here, the ones held by
+    // sequences go away with those sequences
 }
 
 // ========== Content Loading ==========
 
 bool ContentRepository::loadContent() {
-    // Clear any existing content first
-    clearContent();
+    QElapsedTimer timer;
+    timer.start();
+
+    ContentSnapshotPtr next = buildSnapshot();
+    if (!next) {
+        // Nothing usable on disk: serve an empty snapshot
+        next = ContentSnapshotPtr::create();
+    }
+
+    if (preloadSkills) {
+        materializeAllSkills(*next);
+    }
+
+    snapshot = next;
+    contentLoaded = !snapshot->skills.isEmpty();
+
+    lastLoadTimeMs = timer.nsecsElapsed() / 1.0e6;
+    qDebug() << "ContentRepository: Load took" << lastLoadTimeMs << "ms"
+             << (preloadSkills ? (parallelLoading ? "(parallel preload)" : "(serial preload)")
+                               : "(index only)");
+
+    return contentLoaded;
+}
+
+bool ContentRepository::reload() {
+    if (!contentLoaded) {
+        // Nothing to diff against
+        if (!loadContent()) {
+            return false;
+        }
+        emit contentReloaded(getAvailableSkills());
+        return true;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    ContentSnapshotPtr next = buildSnapshot();
+    if (!next) {
+        // Typically a half-saved file; keep serving what we have
+        qWarning() << "ContentRepository: Reload failed, keeping generation" << snapshot->generation;
+        return false;
+    }
+
+    const QStringList changedSkillIds = reuseUnchangedSkills(*next, *snapshot);
+
+    if (preloadSkills) {
+        materializeAllSkills(*next);
+    }
+
+    // Publish. Sessions holding the previous snapshot keep it until they end.
+    // Hold it here too until the signal is handled: listeners still compare
+    // against data from the old generation (e.g. GradeCache::invalidateSkills)
+    const ContentSnapshotPtr previous = snapshot;
+    snapshot = next;
+    contentLoaded = true;
+
+    lastLoadTimeMs = timer.nsecsElapsed() / 1.0e6;
+    qDebug() << "ContentRepository: Reloaded generation" << snapshot->generation
+             << "in" << lastLoadTimeMs << "ms;" << changedSkillIds.size() << "skills changed";
+
+    emit contentReloaded(changedSkillIds);
+    return true;
+}
+
+ContentSnapshotPtr ContentRepository::buildSnapshot() {
+    // Prefer the precompiled pack: no JSON parsing, strings stay in the mapping
+    if (isPackUsable()) {
+        ContentSnapshotPtr next = ContentSnapshotPtr::create();
+        if (indexPack(*next)) {
+            next->generation = nextGeneration++;
+            return next;
+        }
+    }
+
+    ContentSnapshotPtr next = ContentSnapshotPtr::create();
+    if (indexJson(*next)) {
+        next->generation = nextGeneration++;
+        return next;
+    }
+    return ContentSnapshotPtr();
+}
+
+bool ContentRepository::indexPack(ContentSnapshot& target) const {
+    QSharedPointer<ContentPack> pack = QSharedPointer<ContentPack>::create();
+    QString errorMessage;
+    if (!pack->open(packFilePath, &errorMessage)) {
+        qWarning() << "ContentRepository: Ignoring content pack:" << errorMessage;
+        return false;
+    }
+
+    target.pack = pack;
+    target.source = ContentSnapshot::Source::Pack;
+
+    for (int s = 0; s < pack->skillCount(); ++s) {
+        const ContentPack::SkillRecord& record = pack->skill(s);
+
+        // Skill metadata is small and handed to the UI, so it is copied out of the mapping
+        Skill skill;
+        skill.id = pack->stringView(record.id).toString();
+        skill.name = pack->stringView(record.name).toString();
+        skill.language = pack->stringView(record.language).toString();
+        // Interning packs the characters into the registry; nothing references the mapping
+        skill.characterSetId = CharacterSetRegistry::getInstance().intern(
+            skill.language, pack->stringList(record.characterSet));
+        skill.contentHash = ContentPack::contentHash(record);
+        skill.exerciseCount = static_cast<int>(record.exerciseCount);
+        skill.sourceOffset = record.firstExercise;
+
+        if (!skill.id.isEmpty() && skill.exerciseCount > 0) {
+            target.skills[skill.id] = skill;
+
+            // Id keys reference the mapping, which the snapshot releases last
+            for (quint32 e = 0; e < record.exerciseCount; ++e) {
+                const int index = static_cast<int>(record.firstExercise + e);
+                registerExerciseId(target, pack->string(pack->exercise(index).id), skill.id);
+            }
+        }
+    }
+
+    qDebug() << "ContentRepository: Indexed" << target.skills.size() << "skills with"
+             << countExercises(target) << "exercises from content pack" << packFilePath;
+
+    return !target.skills.isEmpty();
+}
 
-    // Open the JSON file
+bool ContentRepository::indexJson(ContentSnapshot& target) const {
+    // Open the JSON file (binary mode keeps byte offsets exact on every platform)
     QFile file(contentFilePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    if (!file.open(QIODevice::ReadOnly)) {
         qWarning() << "ContentRepository: Failed to open" << contentFilePath;
         return false;
     }
 
-    // Read and parse JSON
-    QByteArray jsonData = file.readAll();
+    /**
+     * Collects the exercise ids of the skill being read and registers the skill
+     * when it closes. Only one skill's ids are held at a time.
+     */
+    class IndexHandler : public ContentStreamReader::Handler {
+    public:
+        IndexHandler(const ContentRepository* repository, ContentSnapshot& target)
+            : repository(repository), target(target) {}
+
+        void exercise(const ExerciseSpec& spec) override {
+            // Count the exercises the factory will be able to build, without building them
+            if (ExerciseFactory::isSupportedType(spec.type)) {
+                exerciseIds.append(spec.id);
+            }
+        }
+
+        void skill(const ContentStreamReader::SkillInfo& info) override {
+            QStringList ids;
+            ids.swap(exerciseIds);
+
+            // Validate required fields
+            if (info.id.isEmpty()) {
+                qWarning() << "ContentRepository: Skill missing 'id' field";
+                return;
+            }
+            if (!info.hasExercises) {
+                qWarning() << "ContentRepository: Skill" << info.id << "missing 'exercises' array";
+                return;
+            }
+            if (ids.isEmpty()) {
+                return;
+            }
+
+            Skill indexed;
+            indexed.id = info.id;
+            indexed.name = info.name;
+            indexed.language = info.language;
+            indexed.characterSetId = CharacterSetRegistry::getInstance().intern(
+                info.language, info.characterSet);
+            indexed.contentHash = info.contentHash;
+            indexed.exerciseCount = ids.size();
+            indexed.sourceOffset = info.offset;
+            indexed.sourceLength = info.length;
+
+            target.skills[indexed.id] = indexed;
+            for (const QString& exerciseId : ids) {
+                repository->registerExerciseId(target, exerciseId, indexed.id);
+            }
+            qDebug() << "ContentRepository: Indexed skill" << indexed.id
+                     << "with" << indexed.exerciseCount << "exercises";
+        }
+
+    private:
+        const ContentRepository* repository;
+        ContentSnapshot& target;
+        QStringList exerciseIds;
+    };
+
+    // Stream the document; neither the file nor a DOM is ever held in memory whole
+    target.source = ContentSnapshot::Source::Json;
+    IndexHandler handler(this, target);
+    ContentStreamReader reader(&file);
+    if (!reader.readDocument(&handler)) {
+        qWarning() << "ContentRepository: Invalid JSON format or missing 'skills' array in"
+                   << contentFilePath << "-" << reader.errorString();
+        return false;
+    }
     file.close();
 
-    QJsonDocument doc = QJsonDocument::fromJson(jsonData);
-    if (doc.isNull() || !doc.isObject()) {
-        qWarning() << "ContentRepository: Invalid JSON format in" << contentFilePath;
+    if (target.skills.isEmpty()) {
+        qWarning() << "ContentRepository: No valid skills loaded";
         return false;
     }
 
-    QJsonObject root = doc.object();
+    qDebug() << "ContentRepository: Successfully indexed" << target.skills.size()
+             << "skills with" << countExercises(target) << "total exercises";
+    return true;
+}
+
+bool ContentRepository::isPackUsable() const {
+    QFileInfo packInfo(packFilePath);
+    if (!packInfo.exists()) {
+        return false;
+    }
 
-    // Parse "skills" array
-    if (!root.contains("skills") || !root["skills"].isArray()) {
-        qWarning() << "ContentRepository: Missing or invalid 'skills' array";
+    // A pack older than the JSON it was compiled from would hide authors' edits
+    QFileInfo jsonInfo(contentFilePath);
+    if (jsonInfo.exists() && jsonInfo.lastModified() > packInfo.lastModified()) {
+        qWarning() << "ContentRepository: Content pack is older than" << contentFilePath
+                   << "- falling back to JSON (re-run the content compiler)";
         return false;
     }
 
-    QJsonArray skillsArray = root["skills"].toArray();
+    return true;
+}
+
+QStringList ContentRepository::reuseUnchangedSkills(ContentSnapshot& target,
+                                                    const ContentSnapshot& previous) const {
+    QStringList changedSkillIds;
+
+    for (auto it = target.skills.begin(); it != target.skills.end(); ++it) {
+        Skill& skill = it.value();
+        auto old = previous.skills.constFind(skill.id);
 
-    // Parse each skill
-    for (const QJsonValue& skillValue : skillsArray) {
-        if (!skillValue.isObject()) {
-            qWarning() << "ContentRepository: Skipping invalid skill entry";
+        if (old == previous.skills.constEnd() || skill.contentHash.isEmpty()
+            || old.value().contentHash != skill.contentHash) {
+            changedSkillIds.append(skill.id);
             continue;
         }
 
-        Skill skill = parseSkill(skillValue.toObject());
+        // Same bytes as before: share the built exercises instead of rebuilding.
+        // The arena and the pack they were built from travel with them.
+        if (old.value().materialized) {
+            skill.pack = old.value().pack;
+            skill.arena = old.value().arena;
+            skill.exercises = old.value().exercises;
+            skill.exerciseCount = skill.exercises.size();
+            skill.materialized = true;
+            publishExercises(target, skill);
+        }
+    }
+
+    for (auto it = previous.skills.constBegin(); it != previous.skills.constEnd(); ++it) {
+        if (!target.skills.contains(it.key())) {
+            changedSkillIds.append(it.key());
+        }
+    }
+
+    return changedSkillIds;
+}
+
+// ========== Hot Reload ==========
+
+void ContentRepository::setAutoReload(bool enabled) {
+    if (!enabled) {
+        delete watcher;
+        watcher = nullptr;
+        if (reloadTimer) {
+            reloadTimer->stop();
+        }
+        return;
+    }
+
+    if (watcher) {
+        return;
+    }
+
+    watcher = new QFileSystemWatcher(this);
+    connect(watcher, &QFileSystemWatcher::fileChanged,
+            this, &ContentRepository::onContentFileChanged);
+    connect(watcher, &QFileSystemWatcher::directoryChanged,
+            this, &ContentRepository::onContentFileChanged);
+
+    if (!reloadTimer) {
+        reloadTimer = new QTimer(this);
+        reloadTimer->setSingleShot(true);
+        reloadTimer->setInterval(kReloadDebounceMs);
+        connect(reloadTimer, &QTimer::timeout, this, &ContentRepository::onReloadTimeout);
+    }
+
+    updateWatchedPaths();
+}
+
+bool ContentRepository::isAutoReloadEnabled() const {
+    return watcher != nullptr;
+}
+
+void ContentRepository::onContentFileChanged() {
+    // Restart the countdown on every event so one save triggers one reload
+    reloadTimer->start();
+}
 
-        // Store skill if it has valid exercises
-        if (!skill.id.isEmpty() && !skill.exercises.isEmpty()) {
-            skills[skill.id] = skill;
-            qDebug() << "ContentRepository: Loaded skill" << skill.id
-                     << "with" << skill.exercises.size() << "exercises";
+void ContentRepository::onReloadTimeout() {
+    reload();
+
+    // Saving by rename replaces the file, which drops it from the watch list
+    updateWatchedPaths();
+}
+
+void ContentRepository::updateWatchedPaths() {
+    if (!watcher) {
+        return;
+    }
+
+    // The directory is watched too, so a pack that appears later is noticed
+    QStringList paths;
+    paths << QFileInfo(contentFilePath).absolutePath() << contentFilePath << packFilePath;
+    for (const QString& path : paths) {
+        if (QFileInfo::exists(path) && !watcher->files().contains(path)
+            && !watcher->directories().contains(path)) {
+            watcher->addPath(path);
         }
     }
+}
+
+// ========== Preloading ==========
 
-    contentLoaded = !skills.isEmpty();
+void ContentRepository::materializeAllSkills() {
+    materializeAllSkills(*snapshot);
+}
 
-    if (contentLoaded) {
-        qDebug() << "ContentRepository: Successfully loaded" << skills.size()
-                 << "skills with" << getTotalExerciseCount() << "total exercises";
+void ContentRepository::materializeAllSkills(ContentSnapshot& target) const {
+    // Resolve every pending skill up front on this thread; workers never touch
+    // the containers' structure, only their own Skill and index entries
+    QVector<Skill*> pending;
+    for (auto it = target.skills.begin(); it != target.skills.end(); ++it) {
+        if (!it.value().materialized) {
+            pending.append(&it.value());
+        }
+    }
+    target.exerciseEntries.detach();
+
+    if (parallelLoading && pending.size() > 1) {
+        // Each skill builds into its own arena and fills its own exercise list in
+        // document order, so the result is identical to a serial load
+        QtConcurrent::blockingMap(pending, [this, &target](Skill* skill) {
+            materializeSkill(target, *skill);
+        });
     } else {
-        qWarning() << "ContentRepository: No valid skills loaded";
+        for (Skill* skill : pending) {
+            materializeSkill(target, *skill);
+        }
     }
+}
 
-    return contentLoaded;
+void ContentRepository::setPreloadAllSkills(bool enabled) {
+    preloadSkills = enabled;
 }
 
-bool ContentRepository::reload() {
-    return loadContent();
+void ContentRepository::setParallelLoading(bool enabled) {
+    parallelLoading = enabled;
+}
+
+double ContentRepository::getLastLoadTimeMs() const {
+    return lastLoadTimeMs;
 }
 
 // ========== Content Access ==========
 
 QList<Exercise*> ContentRepository::getExercisesForSkill(const QString& skillId) const {
-    if (!skills.contains(skillId)) {
+    auto it = snapshot->skills.find(skillId);
+    if (it == snapshot->skills.end()) {
         return QList<Exercise*>();
     }
 
+    // Build the skill's exercises on first request
+    materializeSkill(*snapshot, it.value());
+
     // Return a copy of the exercise list
-    // Note: Caller does NOT own these pointers - repository manages memory
-    return skills[skillId].exercises;
+    // Note: Caller does NOT own these pointers - the snapshot manages memory
+    return it.value().exercises;
 }
 
 QList<QString> ContentRepository::getAvailableSkills() const {
-    return skills.keys();
+    return snapshot->skills.keys();
 }
 
 QString ContentRepository::getSkillName(const QString& skillId) const {
-    if (!skills.contains(skillId)) {
-        return QString();
-    }
-    return skills[skillId].name;
+    return snapshot->skills.value(skillId).name;
 }
 
 QString ContentRepository::getSkillLanguage(const QString& skillId) const {
-    if (!skills.contains(skillId)) {
-        return QString();
-    }
-    return skills[skillId].language;
+    return snapshot->skills.value(skillId).language;
 }
 
-QStringList ContentRepository::getSkillCharacterSet(const QString& skillId) const {
-    if (!skills.contains(skillId)) {
-        return QStringList();
+const CharacterSet* ContentRepository::getSkillCharacterSet(const QString& skillId) const {
+    auto it = snapshot->skills.constFind(skillId);
+    if (it == snapshot->skills.constEnd()) {
+        return nullptr;
     }
-    return skills[skillId].characterSet;
+    return CharacterSetRegistry::getInstance().get(it.value().characterSetId);
 }
 
 bool ContentRepository::isLoaded() const {
     return contentLoaded;
 }
 
+ContentSnapshotPtr ContentRepository::getSnapshot() const {
+    return snapshot;
+}
+
+bool ContentRepository::isSkillMaterialized(const QString& skillId) const {
+    auto it = snapshot->skills.constFind(skillId);
+    return it != snapshot->skills.constEnd() && it.value().materialized;
+}
+
 int ContentRepository::getTotalExerciseCount() const {
+    return countExercises(*snapshot);
+}
+
+int ContentRepository::countExercises(const ContentSnapshot& content) {
     int total = 0;
-    for (const Skill& skill : skills) {
-        total += skill.exercises.size();
+    for (const Skill& skill : content.skills) {
+        total += skill.exerciseCount;
     }
     return total;
 }
 
 ExerciseSequencePtr ContentRepository::createSequenceForSkill(const QString& skillId) const {
-    return ExerciseSequencePtr::create(getExercisesForSkill(skillId));
+    return ExerciseSequencePtr::create(getExercisesForSkill(skillId), snapshot);
 }
 
 ExerciseSequencePtr ContentRepository::createSequenceForReview(const QList<QString>& exerciseIds) const {
-    QList<Exercise*> sequence;
+    return ExerciseSequencePtr::create(findExercisesByIds(exerciseIds), snapshot);
+}
+
+QList<Exercise*> ContentRepository::findExercisesByIds(const QList<QString>& exerciseIds) const {
+    QList<Exercise*> result;
+    result.reserve(exerciseIds.size());
+
     for (const QString& exerciseId : exerciseIds) {
-        Exercise* exercise = findExerciseById(exerciseId);
+        Exercise* exercise = getExerciseByIndex(getExerciseIndex(exerciseId));
         if (exercise) {
-            sequence.append(exercise);
+            result.append(exercise);
         }
     }
-    return ExerciseSequencePtr::create(sequence);
+
+    return result;
 }
 
-// ========== Private Helper Methods ==========
+int ContentRepository::getExerciseIndex(const QString& exerciseId) const {
+    return snapshot->exerciseIndex.value(exerciseId, -1);
+}
 
-ContentRepository::Skill ContentRepository::parseSkill(const QJsonObject& skillJson) {
-    Skill skill;
+Exercise* ContentRepository::getExerciseByIndex(int index) const {
+    ContentSnapshot& content = *snapshot;
+    if (index < 0 || index >= content.exerciseEntries.size()) {
+        return nullptr;
+    }
 
-    // Parse skill metadata
-    skill.id = skillJson["id"].toString();
-    skill.name = skillJson["name"].toString();
-    skill.language = skillJson["language"].toString();
-    if (skillJson.contains("characterSet") && skillJson["characterSet"].isArray()) {
-        QJsonArray characters = skillJson["characterSet"].toArray();
-        for (const QJsonValue& value : characters) {
-            skill.characterSet.append(value.toString());
+    // materializeSkill() fills every entry of the skill, so each skill is built once
+    ContentSnapshot::ExerciseEntry& entry = content.exerciseEntries[index];
+    if (!entry.exercise) {
+        auto skillIt = content.skills.find(entry.skillId);
+        if (skillIt != content.skills.end()) {
+            materializeSkill(content, skillIt.value());
         }
     }
+    return entry.exercise;
+}
+
+// ========== Private Helper Methods ==========
 
-    // Validate required fields
-    if (skill.id.isEmpty()) {
-        qWarning() << "ContentRepository: Skill missing 'id' field";
-        return skill;
+// Thread-safe for distinct skills: touches only the skill, its own arena and the
+// index entries of its own exercises (see materializeAllSkills)
+void ContentRepository::materializeSkill(ContentSnapshot& target, Skill& skill) const {
+    if (skill.materialized) {
+        return;
     }
 
-    // Parse exercises array
-    if (!skillJson.contains("exercises") || !skillJson["exercises"].isArray()) {
-        qWarning() << "ContentRepository: Skill" << skill.id << "missing 'exercises' array";
-        return skill;
+    // One arena per skill keeps the skill's exercises next to each other in memory
+    skill.arena = QSharedPointer<ExerciseArena>::create();
+
+    if (target.source == ContentSnapshot::Source::Pack) {
+        materializeFromPack(target, skill);
+    } else if (target.source == ContentSnapshot::Source::Json) {
+        materializeFromJson(skill);
     }
 
-    QJsonArray exercisesArray = skillJson["exercises"].toArray();
+    skill.materialized = true;
+    skill.exerciseCount = skill.exercises.size();
+    publishExercises(target, skill);
 
-    // Parse each exercise
-    for (const QJsonValue& exerciseValue : exercisesArray) {
-        if (!exerciseValue.isObject()) {
-            qWarning() << "ContentRepository: Skipping invalid exercise in skill" << skill.id;
-            continue;
+    qDebug() << "ContentRepository: Materialized skill" << skill.id
+             << "with" << skill.exercises.size() << "exercises";
+}
+
+void ContentRepository::publishExercises(ContentSnapshot& target, const Skill& skill) const {
+    // Make the instances reachable through the id index
+    for (Exercise* exercise : skill.exercises) {
+        const int index = target.exerciseIndex.value(exercise->getId(), -1);
+        if (index >= 0 && target.exerciseEntries[index].skillId == skill.id) {
+            target.exerciseEntries[index].exercise = exercise;
         }
+    }
+}
 
-        QJsonObject exerciseJson = exerciseValue.toObject();
+void ContentRepository::materializeFromPack(const ContentSnapshot& target, Skill& skill) const {
+    // The exercises reference the mapping, so the skill keeps the pack alive
+    skill.pack = target.pack;
 
-        // Extract exercise type
-        QString type = exerciseJson["type"].toString();
-        if (type.isEmpty()) {
-            qWarning() << "ContentRepository: Exercise missing 'type' field in skill" << skill.id;
-            continue;
+    for (int e = 0; e < skill.exerciseCount; ++e) {
+        const int index = static_cast<int>(skill.sourceOffset) + e;
+        Exercise* exercise = ExerciseFactory::createExercise(skill.pack->exerciseSpec(index),
+                                                             skill.arena.data());
+        if (exercise) {
+            addExercise(skill, exercise);
         }
+    }
+}
+
+void ContentRepository::materializeFromJson(Skill& skill) const {
+    // Read back only this skill's byte range
+    QFile file(contentFilePath);
+    if (!file.open(QIODevice::ReadOnly) || !file.seek(skill.sourceOffset)) {
+        qWarning() << "ContentRepository: Failed to reopen" << contentFilePath
+                   << "for skill" << skill.id;
+        return;
+    }
 
-        // DESIGN PATTERN: Factory Pattern
-        // Delegate exercise creation to ExerciseFactory
-        // The repository doesn't need to know the specifics of each exercise type
-        Exercise* exercise = ExerciseFactory::createExercise(type, exerciseJson);
+    /**
+     * Hands each exercise to the factory as soon as it has been read
+     */
+    class MaterializeHandler : public ContentStreamReader::Handler {
+    public:
+        MaterializeHandler(const ContentRepository* repository, Skill& skill)
+            : repository(repository), target(skill), skillMatches(false) {}
+
+        void exercise(const ExerciseSpec& spec) override {
+            if (spec.type.isEmpty()) {
+                qWarning() << "ContentRepository: Exercise missing 'type' field in skill" << target.id;
+                return;
+            }
 
-        if (exercise) {
-            skill.exercises.append(exercise);
-            qDebug() << "ContentRepository: Created" << type << "exercise"
-                     << exercise->getId() << "for skill" << skill.id;
-            TranslateExercise* translateExercise = dynamic_cast<TranslateExercise*>(exercise);
-            if (translateExercise && !skill.characterSet.isEmpty()) {
-                translateExercise->setCharacterSet(skill.characterSet);
-                translateExercise->enableCharacterSelection(true);
+            // DESIGN PATTERN: Factory Pattern
+            // Delegate exercise creation to ExerciseFactory
+            // The repository doesn't need to know the specifics of each exercise type
+            Exercise* exercise = ExerciseFactory::createExercise(spec, target.arena.data());
+
+            if (exercise) {
+                repository->addExercise(target, exercise);
+                qDebug() << "ContentRepository: Created" << spec.type << "exercise"
+                         << exercise->getId() << "for skill" << target.id;
+            } else {
+                qWarning() << "ContentRepository: Failed to create" << spec.type
+                           << "exercise in skill" << target.id;
             }
-        } else {
-            qWarning() << "ContentRepository: Failed to create" << type
-                       << "exercise in skill" << skill.id;
         }
-    }
 
-    return skill;
-}
+        void skill(const ContentStreamReader::SkillInfo& info) override {
+            // Same id and same bytes as when the skill was indexed
+            skillMatches = (info.id == target.id) && (info.contentHash == target.contentHash);
+        }
+
+        bool matched() const { return skillMatches; }
 
-void ContentRepository::clearContent() {
-    // Delete all Exercise instances
-    for (Skill& skill : skills) {
-        qDeleteAll(skill.exercises);
+    private:
+        const ContentRepository* repository;
+        Skill& target;
+        bool skillMatches;
+    };
+
+    MaterializeHandler handler(this, skill);
+    ContentStreamReader reader(&file);
+    const bool ok = reader.readSkill(&handler);
+    file.close();
+
+    if (!ok || !handler.matched()) {
+        qWarning() << "ContentRepository:" << contentFilePath << "changed since it was indexed;"
+                   << "skill" << skill.id << "will be available after the pending reload";
+
+        // Drop anything built from the wrong bytes
         skill.exercises.clear();
+        skill.arena = QSharedPointer<ExerciseArena>::create();
     }
+}
 
-    // Clear the skills map
-    skills.clear();
-    contentLoaded = false;
+void ContentRepository::addExercise(Skill& skill, Exercise* exercise) const {
+    skill.exercises.append(exercise);
+
+    if (exercise->getKind() == ExerciseKind::Translate
+        && skill.characterSetId != CharacterSetRegistry::kNoCharacterSet) {
+        // Only the id is stored per exercise
+        TranslateExercise* translateExercise = static_cast<TranslateExercise*>(exercise);
+        translateExercise->setCharacterSetId(skill.characterSetId);
+        translateExercise->enableCharacterSelection(true);
+    }
 }
 
-Exercise* ContentRepository::findExerciseById(const QString& exerciseId) const {
-    for (const Skill& skill : skills) {
-        for (Exercise* exercise : skill.exercises) {
-            if (exercise && exercise->getId() == exerciseId) {
-                return exercise;
-            }
-        }
+void ContentRepository::registerExerciseId(ContentSnapshot& target, const QString& exerciseId,
+                                           const QString& skillId) const {
+    if (exerciseId.isEmpty()) {
+        return;
     }
-    return nullptr;
+    if (target.exerciseIndex.contains(exerciseId)) {
+        qWarning() << "ContentRepository: Duplicate exercise id" << exerciseId
+                   << "in skill" << skillId << "- keeping the first one";
+        return;
+    }
+
+    target.exerciseIndex.insert(exerciseId, target.exerciseEntries.size());
+    target.exerciseEntries.append(ContentSnapshot::ExerciseEntry{skillId, nullptr});
 }
@@ -1,14 +1,18 @@
 #ifndef CONTENTREPOSITORY_H
 #define CONTENTREPOSITORY_H
 
+#include <QObject>
 #include <QString>
 #include <QStringList>
 #include <QList>
-#include <QMap>
-#include <QJsonObject>
 #include <QSharedPointer>
 #include "../domain/Exercise.h"
 #include "../domain/ExerciseSequence.h"
+#include "../domain/CharacterSet.h"
+#include "ContentSnapshot.h"
+
+class QFileSystemWatcher;
+class QTimer;
 
 using ExerciseSequencePtr = QSharedPointer<ExerciseSequence>;
 
@@ -19,27 +23,55 @@ using ExerciseSequencePtr = QSharedPointer<ExerciseSequence>;
  * Purpose: Load exercises from JSON file, manage content lifecycle
  *
  * Key Responsibilities:
- * 1. Load and parse content.json file
+ * 1. Load the precompiled content pack (content.bqpack) via mmap, or
+ *    fall back to parsing content.json when no usable pack is present
  * 2. Create Exercise instances via ExerciseFactory (Factory Pattern)
  * 3. Provide access to exercises by skill ID
  * 4. Cache loaded content for performance
+ *
+ * Loading is two-phase:
+ * - loadContent() only indexes skill metadata (id, name, language, character set,
+ *   exercise count and where the skill's exercises live in the source)
+ * - The Exercise objects of a skill are built the first time that skill is
+ *   requested, so startup cost and memory do not grow with the number of skills
+ *
+ * content.json is never read into memory whole: ContentStreamReader streams it,
+ * so peak memory while indexing or materializing is bounded by one skill.
+ *
+ * Each skill owns an ExerciseArena holding its exercises contiguously;
+ * tearing a skill down is one bulk release.
+ *
+ * Exercise ids are interned into dense integers during indexing. Lookups by id
+ * are O(1) hash probes and never scan skills.
+ *
+ * Hot reload:
+ * All loaded state lives in a ContentSnapshot. reload() builds a new snapshot,
+ * reuses the built exercises of every skill whose content hash is unchanged and
+ * swaps it in. Sequences created earlier keep their snapshot, so running
+ * sessions are unaffected. With setAutoReload(true) a QFileSystemWatcher
+ * triggers reload() whenever content.json or content.bqpack changes on disk.
  */
-class ContentRepository {
+class ContentRepository : public QObject {
+    Q_OBJECT
+
 private:
-    struct Skill {
-        QString id;
-        QString name;
-        QString language;
-        QStringList characterSet;
-        QList<Exercise*> exercises;
-    };
-
-    QMap<QString, Skill> skills;
+    using Skill = ContentSnapshot::Skill;
+
+    ContentSnapshotPtr snapshot;            // Current generation, never null
     bool contentLoaded;
     QString contentFilePath;
+    QString packFilePath;                   // content.bqpack next to content.json
+    bool preloadSkills;                     // Materialize every skill during loadContent()
+    bool parallelLoading;                   // Spread preloading over the global thread pool
+    double lastLoadTimeMs;
+    int nextGeneration;
+
+    QFileSystemWatcher* watcher;            // Created by setAutoReload(true)
+    QTimer* reloadTimer;                    // Coalesces bursts of file change events
 
 public:
-    explicit ContentRepository(const QString& contentFileName = "content.json");
+    explicit ContentRepository(const QString& contentFileName = "content.json",
+                               QObject* parent = nullptr);
     ~ContentRepository();
 
     bool loadContent();
@@ -48,16 +80,107 @@ public:
     QString getSkillName(const QString& skillId) const;
     QString getSkillLanguage(const QString& skillId) const;
     bool isLoaded() const;
-    bool reload();
     int getTotalExerciseCount() const;
     ExerciseSequencePtr createSequenceForSkill(const QString& skillId) const;
     ExerciseSequencePtr createSequenceForReview(const QList<QString>& exerciseIds) const;
-    QStringList getSkillCharacterSet(const QString& skillId) const;
+
+    /**
+     * Character set of a skill, shared through CharacterSetRegistry
+     * @return nullptr if the skill is unknown or has no character set
+     */
+    const CharacterSet* getSkillCharacterSet(const QString& skillId) const;
+
+    /**
+     * Incrementally reload content from disk
+     * Only skills whose content hash changed are rebuilt; the others keep their
+     * exercises. If the new content cannot be read the current snapshot stays.
+     * Emits contentReloaded() on success, while the previous snapshot is still alive.
+     */
+    bool reload();
+
+    /**
+     * Watch the content files and reload() shortly after they change
+     */
+    void setAutoReload(bool enabled);
+    bool isAutoReloadEnabled() const;
+
+    /**
+     * The snapshot currently served (shared; stays valid across reloads)
+     */
+    ContentSnapshotPtr getSnapshot() const;
+
+    /**
+     * Build the exercises of every skill now instead of on first access
+     * Skills are independent, so with parallel loading enabled they are built
+     * concurrently on QThreadPool::globalInstance(). Results do not depend on
+     * scheduling: each skill keeps its document order and interned ids are
+     * assigned while indexing.
+     */
+    void materializeAllSkills();
+
+    /**
+     * Load options, applied by the next loadContent()/reload()
+     * @param enabled - Preload: materialize all skills during load (default off, lazy)
+     *                  Parallel: use the thread pool when preloading (default on)
+     */
+    void setPreloadAllSkills(bool enabled);
+    void setParallelLoading(bool enabled);
+
+    /**
+     * Wall-clock duration of the last loadContent() or reload(), including any preloading
+     */
+    double getLastLoadTimeMs() const;
+
+    /**
+     * Check whether a skill's exercises have been built yet
+     */
+    bool isSkillMaterialized(const QString& skillId) const;
+
+    /**
+     * Resolve a whole list of exercise ids in one pass
+     * Each owning skill is materialized at most once. Unknown ids are skipped;
+     * the order of the result follows exerciseIds.
+     */
+    QList<Exercise*> findExercisesByIds(const QList<QString>& exerciseIds) const;
+
+    /**
+     * Interned integer id of an exercise (stable until the next reload)
+     * @return -1 if the id is unknown
+     */
+    int getExerciseIndex(const QString& exerciseId) const;
+
+    /**
+     * Exercise for an interned id, materializing its skill if needed
+     */
+    Exercise* getExerciseByIndex(int index) const;
+
+signals:
+    /**
+     * A reload published a new snapshot
+     * @param changedSkillIds - Skills that were added, removed or edited
+     */
+    void contentReloaded(const QStringList& changedSkillIds);
+
+private slots:
+    void onContentFileChanged();
+    void onReloadTimeout();
 
 private:
-    Exercise* findExerciseById(const QString& exerciseId) const;
-    Skill parseSkill(const QJsonObject& skillJson);
-    void clearContent();
+    ContentSnapshotPtr buildSnapshot();
+    bool indexPack(ContentSnapshot& target) const;
+    bool indexJson(ContentSnapshot& target) const;
+    bool isPackUsable() const;
+    QStringList reuseUnchangedSkills(ContentSnapshot& target, const ContentSnapshot& previous) const;
+    void registerExerciseId(ContentSnapshot& target, const QString& exerciseId,
+                            const QString& skillId) const;
+    void materializeAllSkills(ContentSnapshot& target) const;
+    void materializeSkill(ContentSnapshot& target, Skill& skill) const;
+    void materializeFromPack(const ContentSnapshot& target, Skill& skill) const;
+    void materializeFromJson(Skill& skill) const;
+    void publishExercises(ContentSnapshot& target, const Skill& skill) const;
+    void addExercise(Skill& skill, Exercise* exercise) const;
+    void updateWatchedPaths();
+    static int countExercises(const ContentSnapshot& content);
 };
 
 #endif // CONTENTREPOSITORY_H
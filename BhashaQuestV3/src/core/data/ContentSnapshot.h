@@ -0,0 +1,83 @@
+#ifndef CONTENTSNAPSHOT_H
+#define CONTENTSNAPSHOT_H
+
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+#include <QList>
+#include <QMap>
+#include <QHash>
+#include <QVector>
+#include <QSharedPointer>
+#include "../domain/Exercise.h"
+#include "../domain/ExerciseArena.h"
+#include "ContentPack.h"
+
+/**
+ * ContentSnapshot - One generation of loaded content
+ *
+ * ARCHITECTURE: Data Layer
+ * Purpose: Let content be replaced while lessons are running.
+ *
+ * ContentRepository builds a new snapshot on every load or reload and publishes it
+ * by swapping a shared pointer; a published snapshot's content never changes. The
+ * only thing filled in later is a skill's lazily built exercises (its arena, its
+ * exercise list and their exerciseEntries slots). Nothing else is cached on a
+ * published snapshot.
+ *
+ * ExerciseSequence holds on to the snapshot it was created from, so every
+ * Exercise* of a running session stays valid until that session is dropped, no
+ * matter how many reloads happen in between.
+ *
+ * Skills whose content hash did not change share their built exercises (arena
+ * and all) with the previous snapshot instead of being rebuilt.
+ */
+struct ContentSnapshot {
+    enum class Source {
+        None,
+        Pack,                   // Exercises are built from content pack records
+        Json                    // Exercises are parsed from a byte range of content.json
+    };
+
+    struct Skill {
+        QString id;
+        QString name;
+        QString language;
+        int characterSetId;     // CharacterSetRegistry id, shared by all skills with the same alphabet
+        QByteArray contentHash; // Hash of the skill's JSON source
+        int exerciseCount;      // Known at index time, before materialization
+        qint64 sourceOffset;    // JSON: byte offset of the skill object; pack: first exercise record
+        qint64 sourceLength;    // JSON: byte length of the skill object; pack: unused
+        bool materialized;      // True once exercises have been built
+
+        // Declared before the arena: exercises built from a pack reference its
+        // mapping, so the pack must be released last
+        QSharedPointer<ContentPack> pack;
+        QSharedPointer<ExerciseArena> arena;        // Shared with later snapshots if unchanged
+        QList<Exercise*> exercises;                 // Owned by arena
+
+        Skill()
+            : characterSetId(-1), exerciseCount(0), sourceOffset(0), sourceLength(0), materialized(false) {}
+    };
+
+    struct ExerciseEntry {
+        QString skillId;        // Skill that owns the exercise
+        Exercise* exercise;     // nullptr until the owning skill is materialized
+    };
+
+    // Declared first so it is destroyed last: index keys reference the mapping
+    QSharedPointer<ContentPack> pack;
+    Source source;
+    int generation;                             // Increases with every published snapshot
+
+    QMap<QString, Skill> skills;
+    QHash<QString, int> exerciseIndex;          // exercise id -> interned integer id
+    QVector<ExerciseEntry> exerciseEntries;     // interned id -> owner and instance
+
+    ContentSnapshot()
+        : source(Source::None), generation(0) {}
+};
+
+using ContentSnapshotPtr = QSharedPointer<ContentSnapshot>;
+
+#endif // CONTENTSNAPSHOT_H
@@ -0,0 +1,549 @@
+#include "ContentStreamReader.h"
+#include <QtGlobal>
+#include <cmath>
+#include <climits>
+#include <cstring>
+
+/**
+ * ContentStreamReader Implementation
+ *
+ * A small recursive-descent JSON reader over a chunked byte stream.
+ * Only the shape of content.json is interpreted (root -> skills -> exercises);
+ * every other value is skipped without being decoded.
+ */
+
+namespace {
+
+// Guards skipValue() against pathological nesting in hand-edited files
+const int kMaxSkipDepth = 512;
+
+void appendUtf8(QByteArray* out, char32_t codePoint) {
+    if (codePoint < 0x80) {
+        out->append(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        out->append(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out->append(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        out->append(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out->append(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out->append(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        out->append(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out->append(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out->append(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out->append(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+int hexValue(int c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool isNumberChar(int c) {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+} // namespace
+
+ContentStreamReader::ContentStreamReader(QIODevice* device, int chunkSize)
+    : device(device)
+    , basePosition(device ? device->pos() : 0)
+    , chunkStart(0)
+    , chunkLength(0)
+    , chunkPos(0)
+    , endOfData(device == nullptr)
+    , skillHash(QCryptographicHash::Sha1)
+    , hashingSkill(false)
+    , hashFrom(0)
+{
+    chunk.resize(qMax(chunkSize, 64));
+}
+
+// ========== Public Interface ==========
+
+bool ContentStreamReader::readDocument(Handler* handler) {
+    errorMessage.clear();
+
+    // UTF-8 byte order mark
+    if (peek() == 0xEF) {
+        if (!readLiteral("\xEF\xBB\xBF")) {
+            return false;
+        }
+    }
+
+    bool foundSkills = false;
+    skipWhitespace();
+    bool ok = readObject([&](const QString& key) {
+        if (key != QLatin1String("skills") || peek() != '[') {
+            return skipValue();
+        }
+        foundSkills = true;
+        return readArray([&]() {
+            if (peek() != '{') {
+                // Not a skill object; the DOM loader skipped these as well
+                return skipValue();
+            }
+            return readSkillObject(handler);
+        });
+    });
+
+    if (ok && !foundSkills) {
+        return fail("Missing or invalid 'skills' array");
+    }
+    return ok;
+}
+
+bool ContentStreamReader::readSkill(Handler* handler) {
+    errorMessage.clear();
+    skipWhitespace();
+    if (peek() != '{') {
+        return fail("Expected a skill object");
+    }
+    return readSkillObject(handler);
+}
+
+QString ContentStreamReader::errorString() const {
+    return errorMessage;
+}
+
+// ========== Byte Level ==========
+
+bool ContentStreamReader::fill() {
+    if (chunkPos < chunkLength) {
+        return true;
+    }
+    if (endOfData) {
+        return false;
+    }
+
+    // The chunk is about to be overwritten; hash the rest of it first
+    if (hashingSkill) {
+        skillHash.addData(QByteArrayView(chunk.constData() + hashFrom, chunkLength - hashFrom));
+        hashFrom = 0;
+    }
+
+    chunkStart += chunkLength;
+    chunkPos = 0;
+    const qint64 bytesRead = device->read(chunk.data(), chunk.size());
+    chunkLength = bytesRead > 0 ? static_cast<int>(bytesRead) : 0;
+    if (chunkLength == 0) {
+        endOfData = true;
+        return false;
+    }
+    return true;
+}
+
+int ContentStreamReader::peek() {
+    return fill() ? static_cast<uchar>(chunk[chunkPos]) : -1;
+}
+
+int ContentStreamReader::get() {
+    return fill() ? static_cast<uchar>(chunk[chunkPos++]) : -1;
+}
+
+qint64 ContentStreamReader::position() const {
+    return basePosition + chunkStart + chunkPos;
+}
+
+void ContentStreamReader::skipWhitespace() {
+    while (fill()) {
+        const char c = chunk[chunkPos];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            return;
+        }
+        ++chunkPos;
+    }
+}
+
+bool ContentStreamReader::expect(char c) {
+    skipWhitespace();
+    if (get() != static_cast<uchar>(c)) {
+        return fail(QString("Expected '%1'").arg(QLatin1Char(c)));
+    }
+    return true;
+}
+
+bool ContentStreamReader::fail(const QString& message) {
+    // Keep the first (innermost) error
+    if (errorMessage.isEmpty()) {
+        errorMessage = QString("%1 at byte %2").arg(message).arg(position());
+    }
+    return false;
+}
+
+// ========== Token Level ==========
+
+bool ContentStreamReader::readString(QString* out) {
+    if (get() != '"') {
+        return fail("Expected a string");
+    }
+
+    scratch.clear();
+    while (fill()) {
+        // Copy the run of plain bytes up to the next quote or escape in one go
+        const char* begin = chunk.constData() + chunkPos;
+        const char* end = chunk.constData() + chunkLength;
+        const char* run = begin;
+        while (run < end && *run != '"' && *run != '\\') {
+            ++run;
+        }
+        scratch.append(begin, static_cast<int>(run - begin));
+        chunkPos += static_cast<int>(run - begin);
+        if (run == end) {
+            continue;
+        }
+
+        const int c = get();
+        if (c == '"') {
+            if (out) {
+                *out = QString::fromUtf8(scratch);
+            }
+            return true;
+        }
+
+        // Escape sequence
+        const int escaped = get();
+        switch (escaped) {
+        case '"':  scratch.append('"'); break;
+        case '\\': scratch.append('\\'); break;
+        case '/':  scratch.append('/'); break;
+        case 'b':  scratch.append('\b'); break;
+        case 'f':  scratch.append('\f'); break;
+        case 'n':  scratch.append('\n'); break;
+        case 'r':  scratch.append('\r'); break;
+        case 't':  scratch.append('\t'); break;
+        case 'u': {
+            char32_t codePoint = 0;
+            for (int i = 0; i < 4; ++i) {
+                const int digit = hexValue(get());
+                if (digit < 0) {
+                    return fail("Invalid \\u escape");
+                }
+                codePoint = (codePoint << 4) | static_cast<char32_t>(digit);
+            }
+
+            // Combine a UTF-16 surrogate pair written as two escapes
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF && peek() == '\\') {
+                get();
+                if (get() != 'u') {
+                    return fail("Invalid surrogate pair");
+                }
+                char32_t low = 0;
+                for (int i = 0; i < 4; ++i) {
+                    const int digit = hexValue(get());
+                    if (digit < 0) {
+                        return fail("Invalid \\u escape");
+                    }
+                    low = (low << 4) | static_cast<char32_t>(digit);
+                }
+                if (low >= 0xDC00 && low <= 0xDFFF) {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                } else {
+                    appendUtf8(&scratch, 0xFFFD);
+                    codePoint = low;
+                }
+            }
+            if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+                codePoint = 0xFFFD;     // Unpaired surrogate
+            }
+            appendUtf8(&scratch, codePoint);
+            break;
+        }
+        default:
+            return fail("Invalid escape sequence");
+        }
+    }
+
+    return fail("Unterminated string");
+}
+
+bool ContentStreamReader::readLiteral(const char* literal) {
+    for (const char* p = literal; *p; ++p) {
+        if (get() != static_cast<uchar>(*p)) {
+            return fail(QString("Invalid literal, expected '%1'").arg(QLatin1String(literal)));
+        }
+    }
+    return true;
+}
+
+bool ContentStreamReader::readNumber(double* out) {
+    scratch.clear();
+    while (isNumberChar(peek())) {
+        scratch.append(static_cast<char>(get()));
+    }
+
+    bool ok = false;
+    const double value = scratch.toDouble(&ok);
+    if (!ok) {
+        return fail("Invalid number");
+    }
+    if (out) {
+        *out = value;
+    }
+    return true;
+}
+
+bool ContentStreamReader::skipValue() {
+    skipWhitespace();
+
+    int depth = 0;
+    do {
+        const int c = peek();
+        switch (c) {
+        case '"':
+            if (!readString(nullptr)) {
+                return false;
+            }
+            break;
+        case '{':
+        case '[':
+            if (++depth > kMaxSkipDepth) {
+                return fail("Nesting too deep");
+            }
+            get();
+            break;
+        case '}':
+        case ']':
+            if (depth == 0) {
+                return fail("Unexpected closing bracket");
+            }
+            --depth;
+            get();
+            break;
+        case ',':
+        case ':':
+            if (depth == 0) {
+                return fail("Expected a value");
+            }
+            get();
+            break;
+        case 't':
+            if (!readLiteral("true")) return false;
+            break;
+        case 'f':
+            if (!readLiteral("false")) return false;
+            break;
+        case 'n':
+            if (!readLiteral("null")) return false;
+            break;
+        case -1:
+            return fail("Unexpected end of data");
+        default:
+            if (!isNumberChar(c)) {
+                return fail("Unexpected character");
+            }
+            if (!readNumber(nullptr)) {
+                return false;
+            }
+            break;
+        }
+        skipWhitespace();
+    } while (depth > 0);
+
+    return true;
+}
+
+template <typename MemberFn>
+bool ContentStreamReader::readObject(MemberFn onMember) {
+    if (!expect('{')) {
+        return false;
+    }
+    skipWhitespace();
+    if (peek() == '}') {
+        get();
+        return true;
+    }
+
+    QString key;
+    for (;;) {
+        skipWhitespace();
+        if (!readString(&key) || !expect(':')) {
+            return false;
+        }
+        skipWhitespace();
+        if (!onMember(key)) {
+            return false;
+        }
+
+        skipWhitespace();
+        const int c = get();
+        if (c == '}') {
+            return true;
+        }
+        if (c != ',') {
+            return fail("Expected ',' or '}'");
+        }
+    }
+}
+
+template <typename ElementFn>
+bool ContentStreamReader::readArray(ElementFn onElement) {
+    if (!expect('[')) {
+        return false;
+    }
+    skipWhitespace();
+    if (peek() == ']') {
+        get();
+        return true;
+    }
+
+    for (;;) {
+        skipWhitespace();
+        if (!onElement()) {
+            return false;
+        }
+
+        skipWhitespace();
+        const int c = get();
+        if (c == ']') {
+            return true;
+        }
+        if (c != ',') {
+            return fail("Expected ',' or ']'");
+        }
+    }
+}
+
+// ========== Typed Values ==========
+
+bool ContentStreamReader::readStringValue(QString* out) {
+    if (peek() != '"') {
+        return skipValue();
+    }
+    return readString(out);
+}
+
+bool ContentStreamReader::readStringListValue(QStringList* out) {
+    if (peek() != '[') {
+        return skipValue();
+    }
+
+    out->clear();
+    return readArray([&]() {
+        // Non-string elements become empty strings, as QJsonValue::toString() does
+        QString item;
+        if (!readStringValue(&item)) {
+            return false;
+        }
+        out->append(item);
+        return true;
+    });
+}
+
+bool ContentStreamReader::readIntValue(int* out) {
+    const int c = peek();
+    if (c != '-' && (c < '0' || c > '9')) {
+        return skipValue();
+    }
+
+    double value = 0;
+    if (!readNumber(&value)) {
+        return false;
+    }
+    // Same rule as QJsonValue::toInt(): only integral values in range are taken
+    if (std::floor(value) == value && value >= INT_MIN && value <= INT_MAX) {
+        *out = static_cast<int>(value);
+    }
+    return true;
+}
+
+bool ContentStreamReader::readBoolValue(bool* out) {
+    const int c = peek();
+    if (c == 't') {
+        *out = true;
+        return readLiteral("true");
+    }
+    if (c == 'f') {
+        *out = false;
+        return readLiteral("false");
+    }
+    return skipValue();
+}
+
+// ========== Content Level ==========
+
+bool ContentStreamReader::readSkillObject(Handler* handler) {
+    SkillInfo info;
+    info.offset = position();
+
+    // Hash the skill's raw bytes while reading them, so no copy of the object is kept
+    fill();
+    skillHash.reset();
+    hashingSkill = true;
+    hashFrom = chunkPos;
+
+    const bool ok = readObject([&](const QString& key) {
+        if (key == QLatin1String("id")) {
+            return readStringValue(&info.id);
+        }
+        if (key == QLatin1String("name")) {
+            return readStringValue(&info.name);
+        }
+        if (key == QLatin1String("language")) {
+            return readStringValue(&info.language);
+        }
+        if (key == QLatin1String("characterSet")) {
+            return readStringListValue(&info.characterSet);
+        }
+        if (key == QLatin1String("exercises") && peek() == '[') {
+            info.hasExercises = true;
+            return readArray([&]() {
+                if (peek() != '{') {
+                    return skipValue();
+                }
+                ExerciseSpec spec;
+                if (!readExerciseObject(&spec)) {
+                    return false;
+                }
+                ++info.exerciseCount;
+                handler->exercise(spec);
+                return true;
+            });
+        }
+        return skipValue();
+    });
+
+    if (!ok) {
+        hashingSkill = false;
+        return false;
+    }
+
+    skillHash.addData(QByteArrayView(chunk.constData() + hashFrom, chunkPos - hashFrom));
+    hashingSkill = false;
+    info.contentHash = skillHash.result();
+
+    info.length = position() - info.offset;
+    handler->skill(info);
+    return true;
+}
+
+bool ContentStreamReader::readExerciseObject(ExerciseSpec* spec) {
+    return readObject([&](const QString& key) {
+        // Common fields
+        if (key == QLatin1String("type")) return readStringValue(&spec->type);
+        if (key == QLatin1String("id")) return readStringValue(&spec->id);
+        if (key == QLatin1String("prompt")) return readStringValue(&spec->prompt);
+        if (key == QLatin1String("skillId")) return readStringValue(&spec->skillId);
+        if (key == QLatin1String("audioFile")) return readStringValue(&spec->audioFile);
+        if (key == QLatin1String("difficulty")) return readIntValue(&spec->difficulty);
+
+        // MCQ
+        if (key == QLatin1String("options")) return readStringListValue(&spec->options);
+        if (key == QLatin1String("correctIndex")) return readIntValue(&spec->correctIndex);
+
+        // Translate
+        if (key == QLatin1String("englishPhrase")) return readStringValue(&spec->englishPhrase);
+        if (key == QLatin1String("correctAnswers")) return readStringListValue(&spec->correctAnswers);
+        if (key == QLatin1String("targetLanguage")) return readStringValue(&spec->targetLanguage);
+
+        // TileOrder
+        if (key == QLatin1String("tiles")) return readStringListValue(&spec->tiles);
+        if (key == QLatin1String("correctOrder")) return readStringListValue(&spec->correctOrder);
+        if (key == QLatin1String("shuffled")) return readBoolValue(&spec->shuffled);
+
+        return skipValue();
+    });
+}
@@ -0,0 +1,131 @@
+#ifndef CONTENTSTREAMREADER_H
+#define CONTENTSTREAMREADER_H
+
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+#include <QIODevice>
+#include <QCryptographicHash>
+#include "../domain/ExerciseSpec.h"
+
+/**
+ * ContentStreamReader - Incremental (SAX-style) reader for content.json
+ *
+ * ARCHITECTURE: Data Layer
+ * Purpose: Read course files of any size without holding the document in memory.
+ *
+ * The device is consumed in fixed-size chunks. Each exercise object is turned into
+ * an ExerciseSpec and handed to the Handler as soon as its closing brace is read;
+ * skill metadata follows when the skill object closes. Nothing else is retained,
+ * so peak memory is one chunk plus whatever the handler keeps for the current skill.
+ *
+ * Field types are read as leniently as QJsonValue's accessors: a member with an
+ * unexpected type is skipped and keeps its default, exactly like ExerciseSpec::fromJson.
+ */
+class ContentStreamReader {
+public:
+    static constexpr int kDefaultChunkSize = 64 * 1024;
+
+    /**
+     * Metadata of one element of the "skills" array
+     */
+    struct SkillInfo {
+        QString id;
+        QString name;
+        QString language;
+        QStringList characterSet;
+        bool hasExercises;          // "exercises" was present and an array
+        int exerciseCount;          // Exercise objects reported through Handler::exercise()
+        qint64 offset;              // Byte offset of the skill object in the device
+        qint64 length;              // Byte length of the skill object
+        QByteArray contentHash;     // SHA-1 of the skill object's bytes, for change detection
+
+        SkillInfo()
+            : hasExercises(false), exerciseCount(0), offset(0), length(0) {}
+    };
+
+    /**
+     * Receives content as it is read
+     */
+    class Handler {
+    public:
+        virtual ~Handler() = default;
+
+        /**
+         * Called for every exercise object, in document order
+         * Exercises belong to the skill reported by the next skill() call.
+         */
+        virtual void exercise(const ExerciseSpec& spec) = 0;
+
+        /**
+         * Called when a skill object has been read completely
+         */
+        virtual void skill(const SkillInfo& info) = 0;
+    };
+
+    /**
+     * @param device - Open, readable device; reported offsets are absolute device positions
+     * @param chunkSize - Bytes requested from the device per read
+     */
+    explicit ContentStreamReader(QIODevice* device, int chunkSize = kDefaultChunkSize);
+
+    /**
+     * Read a whole content document: { ..., "skills": [ {skill}, ... ], ... }
+     * @return false on malformed input; skills reported before the error stay reported
+     */
+    bool readDocument(Handler* handler);
+
+    /**
+     * Read exactly one skill object starting at the current device position
+     * Used to materialize a single skill from its indexed byte range.
+     */
+    bool readSkill(Handler* handler);
+
+    /**
+     * Description of the last failure, including the byte offset
+     */
+    QString errorString() const;
+
+private:
+    // Byte level
+    bool fill();
+    int peek();
+    int get();
+    qint64 position() const;
+    void skipWhitespace();
+    bool expect(char c);
+    bool fail(const QString& message);
+
+    // Token level
+    bool readString(QString* out);
+    bool readLiteral(const char* literal);
+    bool readNumber(double* out);
+    bool skipValue();
+    template <typename MemberFn> bool readObject(MemberFn onMember);
+    template <typename ElementFn> bool readArray(ElementFn onElement);
+
+    // Lenient typed values (wrong type -> skipped, out untouched)
+    bool readStringValue(QString* out);
+    bool readStringListValue(QStringList* out);
+    bool readIntValue(int* out);
+    bool readBoolValue(bool* out);
+
+    // Content level
+    bool readSkillObject(Handler* handler);
+    bool readExerciseObject(ExerciseSpec* spec);
+
+    QIODevice* device;
+    QByteArray chunk;
+    qint64 basePosition;            // Device position when the reader was created
+    qint64 chunkStart;              // Offset of chunk[0] relative to basePosition
+    int chunkLength;
+    int chunkPos;
+    bool endOfData;
+    QByteArray scratch;             // Reused UTF-8 buffer for string decoding
+    QCryptographicHash skillHash;   // Fed with the raw bytes of the skill being read
+    bool hashingSkill;
+    int hashFrom;                   // First chunk byte not yet added to skillHash
+    QString errorMessage;
+};
+
+#endif // CONTENTSTREAMREADER_H
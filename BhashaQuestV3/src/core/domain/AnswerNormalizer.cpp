@@ -0,0 +1,33 @@
+#include "AnswerNormalizer.h"
+
+namespace {
+
+const QChar kZeroWidthNonJoiner(0x200C);
+const QChar kZeroWidthJoiner(0x200D);
+
+} // namespace
+
+QString AnswerNormalizer::normalize(const QString& text) {
+    // One pass for joiners and whitespace
+    QString collapsed;
+    collapsed.reserve(text.size());
+    bool pendingSpace = false;
+
+    for (const QChar ch : text) {
+        if (ch == kZeroWidthJoiner || ch == kZeroWidthNonJoiner) {
+            continue;
+        }
+        if (ch.isSpace()) {
+            pendingSpace = !collapsed.isEmpty();
+            continue;
+        }
+        if (pendingSpace) {
+            collapsed += QLatin1Char(' ');
+            pendingSpace = false;
+        }
+        collapsed += ch;
+    }
+
+    // Case folding can decompose characters, so compose last
+    return collapsed.toCaseFolded().normalized(QString::NormalizationForm_C);
+}
@@ -0,0 +1,24 @@
+#ifndef ANSWERNORMALIZER_H
+#define ANSWERNORMALIZER_H
+
+#include <QString>
+
+/**
+ * AnswerNormalizer - Canonical form of typed answers for comparison
+ *
+ * Purpose: Two answers that read the same should compare equal. normalize():
+ * 1. Removes zero-width joiners/non-joiners (U+200D, U+200C), which Indic
+ *    keyboards insert inconsistently around conjuncts and half forms
+ * 2. Collapses runs of whitespace to one space and trims both ends
+ * 3. Case-folds (romanized answers are case-insensitive)
+ * 4. Converts to Unicode NFC, so precomposed and decomposed input match
+ *
+ * Accepted answers are normalized once when a TranslateExercise is built;
+ * the grader normalizes the user's input once per submission.
+ */
+class AnswerNormalizer {
+public:
+    static QString normalize(const QString& text);
+};
+
+#endif // ANSWERNORMALIZER_H
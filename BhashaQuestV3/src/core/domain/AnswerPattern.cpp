@@ -0,0 +1,173 @@
+#include "AnswerPattern.h"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+const int kWordBits = 64;
+const int kAsciiRange = 128;
+
+} // namespace
+
+AnswerPattern::AnswerPattern()
+    : blockCount(0) {
+}
+
+AnswerPattern::AnswerPattern(const QString& text)
+    : pattern(text)
+    , blockCount((text.length() + kWordBits - 1) / kWordBits)
+    , asciiSlot(kAsciiRange, 0)
+{
+    const char16_t* units = reinterpret_cast<const char16_t*>(pattern.utf16());
+    const int length = pattern.length();
+
+    distinctUnits.reserve(length);
+    for (int i = 0; i < length; ++i) {
+        distinctUnits.append(units[i]);
+    }
+    std::sort(distinctUnits.begin(), distinctUnits.end());
+    distinctUnits.erase(std::unique(distinctUnits.begin(), distinctUnits.end()), distinctUnits.end());
+
+    for (int index = 0; index < distinctUnits.size(); ++index) {
+        if (distinctUnits.at(index) < kAsciiRange) {
+            asciiSlot[distinctUnits.at(index)] = static_cast<quint8>(index + 1);
+        }
+    }
+
+    // Bit i of a unit's mask is set when pattern position i holds that unit
+    masks.fill(0, distinctUnits.size() * blockCount);
+    for (int i = 0; i < length; ++i) {
+        const int index = static_cast<int>(
+            std::lower_bound(distinctUnits.cbegin(), distinctUnits.cend(), units[i]) - distinctUnits.cbegin());
+        masks[index * blockCount + i / kWordBits] |= quint64(1) << (i % kWordBits);
+    }
+}
+
+const quint64* AnswerPattern::peq(char16_t unit) const {
+    int index;
+    if (unit < kAsciiRange) {
+        index = asciiSlot.at(unit) - 1;
+    } else {
+        auto it = std::lower_bound(distinctUnits.cbegin(), distinctUnits.cend(), unit);
+        index = (it != distinctUnits.cend() && *it == unit) ? static_cast<int>(it - distinctUnits.cbegin()) : -1;
+    }
+    return index < 0 ? nullptr : masks.constData() + index * blockCount;
+}
+
+// ========== Matching ==========
+
+int AnswerPattern::boundedDistance(const QString& input, int maxDistance) const {
+    const int inputLength = input.length();
+    const int patternLength = pattern.length();
+
+    if (std::abs(inputLength - patternLength) > maxDistance) {
+        return maxDistance + 1;
+    }
+    if (patternLength == 0) {
+        return std::min(inputLength, maxDistance + 1);
+    }
+
+    const char16_t* units = reinterpret_cast<const char16_t*>(input.utf16());
+    if (blockCount == 1) {
+        return singleWordDistance(units, inputLength, maxDistance);
+    }
+    return blockedDistance(units, inputLength, maxDistance);
+}
+
+int AnswerPattern::singleWordDistance(const char16_t* input, int inputLength, int maxDistance) const {
+    // Column j of the DP matrix is encoded as vertical deltas: bit i of pv/mv
+    // says D[i+1][j] - D[i][j] is +1/-1. score tracks D[m][j].
+    const quint64 lastBit = quint64(1) << ((pattern.length() - 1) % kWordBits);
+    quint64 pv = ~quint64(0);
+    quint64 mv = 0;
+    int score = pattern.length();
+
+    for (int j = 0; j < inputLength; ++j) {
+        const quint64* eqMask = peq(input[j]);
+        const quint64 eq = eqMask ? *eqMask : 0;
+
+        const quint64 xv = eq | mv;
+        const quint64 xh = (((eq & pv) + pv) ^ pv) | eq;
+        quint64 ph = mv | ~(xh | pv);
+        quint64 mh = pv & xh;
+
+        if (ph & lastBit) {
+            ++score;
+        } else if (mh & lastBit) {
+            --score;
+        }
+
+        // Row 0 grows by one per input character (global alignment)
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+
+        // Each remaining character can lower the score by at most one
+        if (score - (inputLength - j - 1) > maxDistance) {
+            return maxDistance + 1;
+        }
+    }
+
+    return std::min(score, maxDistance + 1);
+}
+
+int AnswerPattern::blockedDistance(const char16_t* input, int inputLength, int maxDistance) const {
+    // Same recurrence as singleWordDistance, one 64-row block at a time; the
+    // horizontal delta leaving the top of a block enters the next one
+    const quint64 lastBit = quint64(1) << ((pattern.length() - 1) % kWordBits);
+    const quint64 topBit = quint64(1) << (kWordBits - 1);
+
+    // Reused per thread so matching long answers does not allocate either
+    thread_local std::vector<quint64> pvBlocks;
+    thread_local std::vector<quint64> mvBlocks;
+    pvBlocks.assign(blockCount, ~quint64(0));
+    mvBlocks.assign(blockCount, 0);
+    int score = pattern.length();
+
+    for (int j = 0; j < inputLength; ++j) {
+        const quint64* eqMask = peq(input[j]);
+        int carry = 1;
+
+        for (int block = 0; block < blockCount; ++block) {
+            quint64 eq = eqMask ? eqMask[block] : 0;
+            const quint64 pv = pvBlocks[block];
+            const quint64 mv = mvBlocks[block];
+
+            const quint64 xv = eq | mv;
+            if (carry < 0) {
+                eq |= 1;
+            }
+            const quint64 xh = (((eq & pv) + pv) ^ pv) | eq;
+            quint64 ph = mv | ~(xh | pv);
+            quint64 mh = pv & xh;
+
+            const quint64 outBit = (block == blockCount - 1) ? lastBit : topBit;
+            int carryOut = 0;
+            if (ph & outBit) {
+                carryOut = 1;
+            } else if (mh & outBit) {
+                carryOut = -1;
+            }
+
+            ph <<= 1;
+            mh <<= 1;
+            if (carry < 0) {
+                mh |= 1;
+            } else if (carry > 0) {
+                ph |= 1;
+            }
+            pvBlocks[block] = mh | ~(xv | ph);
+            mvBlocks[block] = ph & xv;
+            carry = carryOut;
+        }
+
+        score += carry;
+        if (score - (inputLength - j - 1) > maxDistance) {
+            return maxDistance + 1;
+        }
+    }
+
+    return std::min(score, maxDistance + 1);
+}
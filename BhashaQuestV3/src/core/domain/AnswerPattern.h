@@ -0,0 +1,57 @@
+#ifndef ANSWERPATTERN_H
+#define ANSWERPATTERN_H
+
+#include <QString>
+#include <QVector>
+
+/**
+ * AnswerPattern - One accepted answer, precompiled for bit-parallel matching
+ *
+ * Purpose: TranslateGrader compares every submitted answer against each accepted
+ * answer of the exercise. The pattern stores, per distinct UTF-16 unit of the
+ * answer, the bitmask of positions where it occurs ("peq" masks), so the edit
+ * distance to any input can be computed with Myers' bit-vector algorithm
+ * (Hyyrö's formulation): one handful of word operations per input character
+ * instead of one matrix row.
+ *
+ * Answers of up to 64 units fit in a single 64-bit word. Longer answers use
+ * blocks of 64 bits with the horizontal delta carried from block to block.
+ *
+ * Built once per accepted answer when a TranslateExercise is created; immutable
+ * afterwards, so one pattern can be matched from several threads.
+ */
+class AnswerPattern {
+public:
+    AnswerPattern();
+
+    /**
+     * @param text - The answer exactly as inputs will be compared against it
+     *               (callers normalize with AnswerNormalizer before building)
+     */
+    explicit AnswerPattern(const QString& text);
+
+    const QString& text() const { return pattern; }
+    int length() const { return pattern.length(); }
+
+    /**
+     * Levenshtein distance from input to this answer, if it is at most maxDistance
+     * Inputs whose length differs by more than maxDistance are rejected without
+     * scanning, and scanning stops once the distance can no longer come back
+     * under the limit.
+     * @return The distance if <= maxDistance, otherwise maxDistance + 1
+     */
+    int boundedDistance(const QString& input, int maxDistance) const;
+
+private:
+    const quint64* peq(char16_t unit) const;
+    int singleWordDistance(const char16_t* input, int inputLength, int maxDistance) const;
+    int blockedDistance(const char16_t* input, int inputLength, int maxDistance) const;
+
+    QString pattern;
+    int blockCount;                     // 64-bit words per mask
+    QVector<quint8> asciiSlot;          // Unit < 128 -> 1 + index into distinctUnits, 0 if absent
+    QVector<char16_t> distinctUnits;    // Sorted distinct units of the pattern
+    QVector<quint64> masks;             // [index * blockCount + block]
+};
+
+#endif // ANSWERPATTERN_H
@@ -0,0 +1,326 @@
+#include "AnswerTrie.h"
+#include <QtAlgorithms>
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const int kWordBits = 64;
+const int kAsciiRange = 128;
+
+// Smallest D[i][depth] with |i - depth| <= maxDistance, for a column stored as
+// vertical deltas (see matchesBitParallel). Counts the deltas below the band
+// to get from D[m] to its bottom cell, then walks its 2k + 1 cells up.
+int bandMinimum(quint64 pv, quint64 mv, int score, int depth, int inputLength, int maxDistance) {
+    const int bandFirst = std::max(0, depth - maxDistance);
+    const int bandLast = std::min(inputLength, depth + maxDistance);
+    if (bandFirst > bandLast) {
+        return maxDistance + 1;
+    }
+
+    int cell = score;
+    if (bandLast < inputLength) {
+        // Bits at or above inputLength carry no rows
+        const quint64 belowBand = (~quint64(0) << bandLast) & (~quint64(0) >> (kWordBits - inputLength));
+        cell -= static_cast<int>(qPopulationCount(pv & belowBand))
+              - static_cast<int>(qPopulationCount(mv & belowBand));
+    }
+    int minimum = cell;
+    for (int i = bandLast; i > bandFirst; --i) {
+        cell -= static_cast<int>((pv >> (i - 1)) & 1) - static_cast<int>((mv >> (i - 1)) & 1);
+        minimum = std::min(minimum, cell);
+    }
+    return minimum;
+}
+
+} // namespace
+
+AnswerTrie::AnswerTrie() {
+    nodes.append(Node{0, false, 0, 0, INT_MAX, -1});
+}
+
+AnswerTrie::AnswerTrie(const QStringList& answers) {
+    // Build with per-node child lists, then flatten breadth-first so the
+    // children of a node sit next to each other
+    struct BuildNode {
+        char16_t unit;
+        bool terminal;
+        QVector<int> children;
+    };
+    QVector<BuildNode> building;
+    building.append(BuildNode{0, false, {}});
+
+    for (const QString& answer : answers) {
+        const char16_t* units = reinterpret_cast<const char16_t*>(answer.utf16());
+        int current = 0;
+
+        for (int i = 0; i < answer.length(); ++i) {
+            int next = -1;
+            for (int child : building.at(current).children) {
+                if (building.at(child).unit == units[i]) {
+                    next = child;
+                    break;
+                }
+            }
+            if (next < 0) {
+                next = building.size();
+                building.append(BuildNode{units[i], false, {}});
+                building[current].children.append(next);
+            }
+            current = next;
+        }
+
+        if (!building.at(current).terminal) {
+            building[current].terminal = true;
+            patterns.append(AnswerPattern(answer));
+
+            ClusterText clusters(answer);
+            if (clusters.hasWeightedScript()) {
+                weightedAnswers.append(clusters);
+            }
+        }
+    }
+
+    QVector<int> order;
+    QVector<int> depths;
+    order.reserve(building.size());
+    depths.reserve(building.size());
+    order.append(0);
+    depths.append(0);
+    nodes.reserve(building.size());
+    nodes.append(Node{0, building.at(0).terminal, 0, 0, INT_MAX, -1});
+
+    for (int position = 0; position < order.size(); ++position) {
+        QVector<int> children = building.at(order.at(position)).children;
+        std::sort(children.begin(), children.end(), [&building](int a, int b) {
+            return building.at(a).unit < building.at(b).unit;
+        });
+
+        nodes[position].firstChild = nodes.size();
+        nodes[position].childCount = children.size();
+        for (int child : children) {
+            order.append(child);
+            depths.append(depths.at(position) + 1);
+            nodes.append(Node{building.at(child).unit, building.at(child).terminal, 0, 0, INT_MAX, -1});
+        }
+    }
+
+    // Children come after their parent, so one backward pass sees every subtree complete
+    for (int position = nodes.size() - 1; position >= 0; --position) {
+        Node& node = nodes[position];
+        if (node.terminal) {
+            node.shortestBelow = depths.at(position);
+            node.longestBelow = depths.at(position);
+        }
+        for (int child = node.firstChild; child < node.firstChild + node.childCount; ++child) {
+            node.shortestBelow = std::min(node.shortestBelow, nodes.at(child).shortestBelow);
+            node.longestBelow = std::max(node.longestBelow, nodes.at(child).longestBelow);
+        }
+    }
+}
+
+int AnswerTrie::findChild(const Node& node, char16_t unit) const {
+    const Node* first = nodes.constData() + node.firstChild;
+    const Node* last = first + node.childCount;
+    const Node* it = std::lower_bound(first, last, unit, [](const Node& child, char16_t value) {
+        return child.unit < value;
+    });
+    return (it != last && it->unit == unit) ? static_cast<int>(it - nodes.constData()) : -1;
+}
+
+bool AnswerTrie::reachable(const Node& node, int inputLength, int maxDistance) const {
+    // Each unit of length difference costs an insertion or a deletion
+    return node.shortestBelow <= inputLength + maxDistance
+        && node.longestBelow >= inputLength - maxDistance;
+}
+
+// ========== Matching ==========
+
+bool AnswerTrie::contains(const QString& input) const {
+    const char16_t* units = reinterpret_cast<const char16_t*>(input.utf16());
+    int current = 0;
+
+    for (int i = 0; i < input.length(); ++i) {
+        current = findChild(nodes.at(current), units[i]);
+        if (current < 0) {
+            return false;
+        }
+    }
+    return nodes.at(current).terminal;
+}
+
+bool AnswerTrie::matches(const QString& input, int maxDistance) const {
+    const int inputLength = input.length();
+    if (patterns.size() <= kDirectMatchLimit || inputLength > kWordBits) {
+        return matchesEachPattern(input, maxDistance);
+    }
+
+    // An empty accepted answer is reached by deleting the whole input
+    if (nodes.at(0).terminal && inputLength <= maxDistance) {
+        return true;
+    }
+    if (inputLength == 0) {
+        return nodes.at(0).shortestBelow <= maxDistance;
+    }
+    return matchesBitParallel(reinterpret_cast<const char16_t*>(input.utf16()), inputLength, maxDistance);
+}
+
+bool AnswerTrie::matchesWeighted(const QString& input, int maxCost) const {
+    if (weightedAnswers.isEmpty()) {
+        return false;
+    }
+
+    // Text without Devanagari or Kannada prices every edit at a full edit,
+    // which matches() has already checked
+    const ClusterText clusters(input);
+    if (!clusters.hasWeightedScript()) {
+        return false;
+    }
+
+    for (const ClusterText& answer : weightedAnswers) {
+        if (ClusterDistance::boundedDistance(clusters, answer, maxCost) <= maxCost) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AnswerTrie::matchesEachPattern(const QString& input, int maxDistance) const {
+    for (const AnswerPattern& pattern : patterns) {
+        // Exact match first: a plain comparison, no masks involved
+        if (input == pattern.text()) {
+            return true;
+        }
+    }
+    for (const AnswerPattern& pattern : patterns) {
+        if (pattern.boundedDistance(input, maxDistance) <= maxDistance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AnswerTrie::matchesBitParallel(const char16_t* input, int inputLength, int maxDistance) const {
+    // The automaton state after reading a trie path of depth d is column d of
+    // the DP matrix between the input (rows) and the path, stored as vertical
+    // deltas (bit i of pv/mv: D[i+1][d] - D[i][d] is +1/-1) plus score = D[m][d].
+    // A trie character advances it with the same step AnswerPattern uses.
+    const quint64 lastBit = quint64(1) << (inputLength - 1);
+
+    // Positions of each input unit. The ASCII table is cleared again on exit,
+    // so a lookup costs one load and no call allocates.
+    thread_local quint64 asciiPeq[kAsciiRange] = {};
+    thread_local std::vector<std::pair<char16_t, quint64>> otherPeq;
+    otherPeq.clear();
+    for (int i = 0; i < inputLength; ++i) {
+        if (input[i] < kAsciiRange) {
+            asciiPeq[input[i]] |= quint64(1) << i;
+        } else {
+            otherPeq.push_back({input[i], quint64(1) << i});
+        }
+    }
+    std::sort(otherPeq.begin(), otherPeq.end());
+    int merged = 0;
+    for (const auto& entry : otherPeq) {
+        if (merged > 0 && otherPeq[merged - 1].first == entry.first) {
+            otherPeq[merged - 1].second |= entry.second;
+        } else {
+            otherPeq[merged++] = entry;
+        }
+    }
+    otherPeq.resize(merged);
+
+    auto peq = [&](char16_t unit) -> quint64 {
+        if (unit < kAsciiRange) {
+            return asciiPeq[unit];
+        }
+        auto it = std::lower_bound(otherPeq.begin(), otherPeq.end(), std::make_pair(unit, quint64(0)));
+        return (it != otherPeq.end() && it->first == unit) ? it->second : 0;
+    };
+
+    struct Frame {
+        int node;
+        int depth;
+        quint64 pv;                     // Parent's column
+        quint64 mv;
+        int score;
+    };
+    thread_local std::vector<Frame> frames;
+    std::vector<Frame>& stack = frames;
+    stack.clear();
+
+    // Column 0: D[i][0] = i
+    const Node& root = nodes.at(0);
+    for (int child = root.childCount - 1; child >= 0; --child) {
+        stack.push_back(Frame{root.firstChild + child, 1, ~quint64(0), 0, inputLength});
+    }
+
+    bool found = false;
+    while (!stack.empty() && !found) {
+        const Frame frame = stack.back();
+        stack.pop_back();
+
+        int index = frame.node;
+        int depth = frame.depth;
+        quint64 pv = frame.pv;
+        quint64 mv = frame.mv;
+        int score = frame.score;
+
+        // Follow the branch down through its first child; siblings wait on the
+        // stack, so long unshared suffixes run without stack traffic
+        for (;;) {
+            const Node& node = nodes.at(index);
+            if (!reachable(node, inputLength, maxDistance)) {
+                break;
+            }
+
+            const quint64 eq = peq(node.unit);
+            const quint64 xv = eq | mv;
+            const quint64 xh = (((eq & pv) + pv) ^ pv) | eq;
+            quint64 ph = mv | ~(xh | pv);
+            quint64 mh = pv & xh;
+
+            if (ph & lastBit) {
+                ++score;
+            } else if (mh & lastBit) {
+                --score;
+            }
+
+            // Row 0 grows by one per path character (global alignment)
+            ph = (ph << 1) | 1;
+            mh <<= 1;
+            pv = mh | ~(xv | ph);
+            mv = ph & xv;
+
+            if (node.terminal && score <= maxDistance) {
+                found = true;
+                break;
+            }
+
+            // Every longer answer below this node crosses this column somewhere in
+            // the band |i - depth| <= k. Checking it costs a few Myers steps, so it
+            // runs every k + 1 levels: a dead branch lives at most k nodes longer.
+            if (depth % (maxDistance + 1) == 0
+                && bandMinimum(pv, mv, score, depth, inputLength, maxDistance) > maxDistance) {
+                break;
+            }
+
+            if (node.childCount == 0) {
+                break;
+            }
+            for (int child = node.childCount - 1; child > 0; --child) {
+                stack.push_back(Frame{node.firstChild + child, depth + 1, pv, mv, score});
+            }
+            index = node.firstChild;
+            ++depth;
+        }
+    }
+    for (int i = 0; i < inputLength; ++i) {
+        if (input[i] < kAsciiRange) {
+            asciiPeq[input[i]] = 0;
+        }
+    }
+    return found;
+}
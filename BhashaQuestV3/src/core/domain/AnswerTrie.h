@@ -0,0 +1,85 @@
+#ifndef ANSWERTRIE_H
+#define ANSWERTRIE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include "AnswerPattern.h"
+#include "ClusterDistance.h"
+
+/**
+ * AnswerTrie - All accepted answers of an exercise, compiled for one-pass matching
+ *
+ * Purpose: Translate exercises list several accepted spellings ("पानी", "pani",
+ * "paani"). Testing them one after another makes grading cost grow with every
+ * variant an author adds. The trie shares common prefixes and is walked once
+ * with a Levenshtein automaton of the user's input: each trie node advances its
+ * parent's automaton state by one character, so a shared prefix is matched once
+ * for all the variants below it. A branch is abandoned as soon as every state
+ * in the band |depth - position| <= k exceeds k, or when no answer below it
+ * has a length within k of the input's.
+ *
+ * The automaton runs bit-parallel, one 64-bit DP column per node (the same
+ * step as AnswerPattern, with the input as the pattern). Per node that costs
+ * more than one AnswerPattern step, so exercises with only a few answers, and
+ * inputs longer than 64 units, are matched against each AnswerPattern instead.
+ *
+ * Built once per exercise at content load from AnswerNormalizer forms;
+ * immutable afterwards and safe to match from several threads.
+ */
+class AnswerTrie {
+public:
+    AnswerTrie();
+
+    /**
+     * @param answers - Accepted answers, already normalized
+     */
+    explicit AnswerTrie(const QStringList& answers);
+
+    bool isEmpty() const { return patterns.isEmpty(); }
+    int size() const { return patterns.size(); }      // Distinct answers
+    const QString& answerAt(int index) const { return patterns.at(index).text(); }
+
+    /**
+     * Exact lookup (one walk down the trie)
+     */
+    bool contains(const QString& input) const;
+
+    /**
+     * True if some accepted answer is within maxDistance edits of input
+     * @param input - Normalized user answer
+     */
+    bool matches(const QString& input, int maxDistance) const;
+
+    /**
+     * True if some Devanagari or Kannada answer is within maxCost of input
+     * by ClusterDistance (confusion-weighted, over grapheme clusters)
+     * @param maxCost - In ClusterDistance::kEditCost units per edit
+     */
+    bool matchesWeighted(const QString& input, int maxCost) const;
+    bool hasWeightedAnswers() const { return !weightedAnswers.isEmpty(); }
+
+    // Up to this many answers, testing each AnswerPattern beats walking the trie
+    static const int kDirectMatchLimit = 8;
+
+private:
+    struct Node {
+        char16_t unit;                  // Edge label from the parent
+        bool terminal;                  // An accepted answer ends here
+        int firstChild;                 // Children are contiguous, sorted by unit
+        int childCount;
+        int shortestBelow;              // Depth of the shallowest and deepest answers
+        int longestBelow;               // in this subtree (including the node itself)
+    };
+
+    int findChild(const Node& node, char16_t unit) const;
+    bool reachable(const Node& node, int inputLength, int maxDistance) const;
+    bool matchesEachPattern(const QString& input, int maxDistance) const;
+    bool matchesBitParallel(const char16_t* input, int inputLength, int maxDistance) const;
+
+    QVector<Node> nodes;                // nodes[0] is the root
+    QVector<AnswerPattern> patterns;    // One per distinct answer, in input order
+    QVector<ClusterText> weightedAnswers;   // Answers in a script with a confusion table
+};
+
+#endif // ANSWERTRIE_H
@@ -1,16 +1,16 @@
 #include "CharacterSelectionGrader.h"
 #include "TranslateExercise.h"
 
-Result CharacterSelectionGrader::grade(const QString& userAnswer, const Exercise* exercise) {
-    // Cast to TranslateExercise to get correct answers
-    const TranslateExercise* translateExercise = dynamic_cast<const TranslateExercise*>(exercise);
-    if (!translateExercise) {
-        return Result{false, 0, "Invalid exercise type for character selection."};
+GradeOutcome CharacterSelectionGrader::evaluate(const QString& userAnswer, const Exercise* exercise) const {
+    // Check the type tag, then cast to TranslateExercise to get correct answers
+    if (!exercise || exercise->getKind() != ExerciseKind::Translate) {
+        return GradeOutcome(GradeOutcome::InvalidExercise);
     }
+    const TranslateExercise* translateExercise = static_cast<const TranslateExercise*>(exercise);
 
     // Handle empty answer
     if (userAnswer.isEmpty()) {
-        return Result{false, 0, "Please select all characters."};
+        return GradeOutcome(GradeOutcome::EmptyAnswer);
     }
 
     // Parse user answer (remove semicolons)
@@ -22,15 +22,29 @@ Result CharacterSelectionGrader::grade(const QString& userAnswer, const Exercise
     // Check against all valid answers
     for (const QString& correctAnswer : correctAnswers) {
         if (userSequence == correctAnswer) {
-            return Result{true, 10, "Correct!"};
+            return GradeOutcome(GradeOutcome::Correct, 10);
         }
     }
 
     // No match found
-    return Result{false, 0, "Incorrect sequence. Please try again."};
+    return GradeOutcome(GradeOutcome::Incorrect);
 }
 
-QString CharacterSelectionGrader::parseCharacterSequence(const QString& separatedSequence) const {
+QString CharacterSelectionGrader::feedback(const GradeOutcome& outcome, const Exercise* /*exercise*/) const {
+    switch (outcome.status) {
+        case GradeOutcome::Correct:
+            return "Correct!";
+        case GradeOutcome::Incorrect:
+            return "Incorrect sequence. Please try again.";
+        case GradeOutcome::EmptyAnswer:
+        case GradeOutcome::InvalidAnswer:
+            return "Please select all characters.";
+        default:
+            return "Invalid exercise type for character selection.";
+    }
+}
+
+QString CharacterSelectionGrader::parseCharacterSequence(const QString& separatedSequence) {
     // Split by semicolon and rejoin without separators
     QStringList characters = separatedSequence.split(";");
     return characters.join("");
@@ -33,7 +33,7 @@ public:
      *
      * @param userAnswer - Semicolon-separated selected characters (e.g., "न;म;स")
      * @param exercise - The exercise being graded (must be TranslateExercise)
-     * @return Result with correct flag, score, and feedback
+     * @return Outcome with status and score (feedback() builds the message)
      *
      * Process:
      * 1. Remove semicolon separators from user answer
@@ -41,16 +41,16 @@ public:
      * 3. Compare strings for exact match
      * 4. Return result with 10 points if correct, 0 if incorrect
      */
-    Result grade(const QString& userAnswer, const Exercise* exercise) override;
+    GradeOutcome evaluate(const QString& userAnswer, const Exercise* exercise) const override;
+    QString feedback(const GradeOutcome& outcome, const Exercise* exercise) const override;
 
-private:
     /**
      * Parse character sequence from semicolon-separated format
      *
      * @param separatedSequence Input like "न;म;स"
      * @return Reconstructed string like "नमस"
      */
-    QString parseCharacterSequence(const QString& separatedSequence) const;
+    static QString parseCharacterSequence(const QString& separatedSequence);
 };
 
 #endif // CHARACTERSELECTIONGRADER_H
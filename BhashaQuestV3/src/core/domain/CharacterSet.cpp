@@ -0,0 +1,68 @@
+#include "CharacterSet.h"
+
+CharacterSet::CharacterSet(const QStringList& characters)
+    : bitsetBase(0)
+{
+    codePoints.reserve(characters.size());
+
+    for (const QString& character : characters) {
+        const QList<uint> ucs4 = character.toUcs4();
+        if (ucs4.size() == 1) {
+            const char32_t codePoint = static_cast<char32_t>(ucs4.first());
+            if (!codePoints.contains(codePoint)) {
+                codePoints.append(codePoint);
+            }
+        } else if (!ucs4.isEmpty() && !clusters.contains(character)) {
+            clusters.append(character);
+        }
+    }
+
+    if (codePoints.isEmpty()) {
+        return;
+    }
+
+    // A script's letters sit in one Unicode block, so the bitset is a few words
+    char32_t lowest = codePoints.first();
+    char32_t highest = codePoints.first();
+    for (char32_t codePoint : codePoints) {
+        lowest = qMin(lowest, codePoint);
+        highest = qMax(highest, codePoint);
+    }
+
+    bitsetBase = lowest;
+    bitset.fill(0, static_cast<int>((highest - lowest) / 64 + 1));
+    for (char32_t codePoint : codePoints) {
+        const char32_t bit = codePoint - bitsetBase;
+        bitset[static_cast<int>(bit / 64)] |= quint64(1) << (bit % 64);
+    }
+}
+
+bool CharacterSet::contains(char32_t codePoint) const {
+    if (codePoint < bitsetBase) {
+        return false;
+    }
+    const char32_t bit = codePoint - bitsetBase;
+    const int word = static_cast<int>(bit / 64);
+    return word < bitset.size() && (bitset.at(word) & (quint64(1) << (bit % 64))) != 0;
+}
+
+QString CharacterSet::characterAt(int index) const {
+    if (index < codePoints.size()) {
+        const char32_t codePoint = codePoints.at(index);
+        return QString::fromUcs4(&codePoint, 1);
+    }
+    return clusters.at(index - codePoints.size());
+}
+
+QStringList CharacterSet::toStringList() const {
+    QStringList characters;
+    characters.reserve(size());
+    for (int i = 0; i < size(); ++i) {
+        characters.append(characterAt(i));
+    }
+    return characters;
+}
+
+bool CharacterSet::operator==(const CharacterSet& other) const {
+    return codePoints == other.codePoints && clusters == other.clusters;
+}
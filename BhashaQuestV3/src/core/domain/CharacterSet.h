@@ -0,0 +1,59 @@
+#ifndef CHARACTERSET_H
+#define CHARACTERSET_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * CharacterSet - Compact, immutable set of characters for one language
+ *
+ * Purpose: Backs the character picker of Translate exercises.
+ * Characters are stored once as a packed array of code points (in content order)
+ * plus a membership bitset over the script's code point range, instead of a list
+ * of one-character QStrings per exercise.
+ *
+ * Entries that are not a single code point (e.g. a conjunct written as several
+ * code points) are kept as strings after the packed part; characterAt() order is
+ * code points first, then those clusters.
+ *
+ * Instances are created and shared by CharacterSetRegistry.
+ */
+class CharacterSet {
+public:
+    explicit CharacterSet(const QStringList& characters = QStringList());
+
+    int size() const { return codePoints.size() + clusters.size(); }
+    bool isEmpty() const { return size() == 0; }
+
+    /**
+     * Number of entries that are a single code point (indices [0, codePointCount()))
+     */
+    int codePointCount() const { return codePoints.size(); }
+    char32_t codePointAt(int index) const { return codePoints.at(index); }
+
+    /**
+     * O(1) membership test for a single code point
+     */
+    bool contains(char32_t codePoint) const;
+
+    /**
+     * Entry as text (one code point or one multi-code-point cluster)
+     */
+    QString characterAt(int index) const;
+
+    /**
+     * Expand to the original list form (for display or legacy callers)
+     */
+    QStringList toStringList() const;
+
+    bool operator==(const CharacterSet& other) const;
+
+private:
+    QVector<char32_t> codePoints;       // Single code point entries, content order
+    QStringList clusters;               // Multi code point entries
+    char32_t bitsetBase;                // Lowest code point covered by the bitset
+    QVector<quint64> bitset;            // Bit (cp - bitsetBase) set if cp is in the set
+};
+
+#endif // CHARACTERSET_H
@@ -0,0 +1,60 @@
+#include "CharacterSetRegistry.h"
+#include <QMutexLocker>
+#include <QDebug>
+
+CharacterSetRegistry::CharacterSetRegistry() {
+}
+
+CharacterSetRegistry& CharacterSetRegistry::getInstance() {
+    // Singleton Pattern: function-local static, created on first access
+    static CharacterSetRegistry instance;
+    return instance;
+}
+
+int CharacterSetRegistry::intern(const QString& language, const QStringList& characters) {
+    if (characters.isEmpty()) {
+        return kNoCharacterSet;
+    }
+
+    // Build the compact form first; comparing packed arrays is cheaper than lists
+    QSharedPointer<const CharacterSet> candidate(new CharacterSet(characters));
+
+    QMutexLocker locker(&mutex);
+
+    const QList<int> ids = idsByLanguage.values(language);
+    for (int id : ids) {
+        if (*entries.at(id).characterSet == *candidate) {
+            return id;
+        }
+    }
+
+    const int id = entries.size();
+    entries.append(Entry{language, candidate});
+    idsByLanguage.insert(language, id);
+
+    qDebug() << "CharacterSetRegistry: Registered set" << id << "for" << language
+             << "with" << candidate->size() << "characters";
+    return id;
+}
+
+const CharacterSet* CharacterSetRegistry::get(int id) const {
+    QMutexLocker locker(&mutex);
+    if (id < 0 || id >= entries.size()) {
+        return nullptr;
+    }
+    // Sets are immutable and never released, so the pointer outlives the lock
+    return entries.at(id).characterSet.data();
+}
+
+QString CharacterSetRegistry::getLanguage(int id) const {
+    QMutexLocker locker(&mutex);
+    if (id < 0 || id >= entries.size()) {
+        return QString();
+    }
+    return entries.at(id).language;
+}
+
+int CharacterSetRegistry::count() const {
+    QMutexLocker locker(&mutex);
+    return entries.size();
+}
@@ -0,0 +1,67 @@
+#ifndef CHARACTERSETREGISTRY_H
+#define CHARACTERSETREGISTRY_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QMultiHash>
+#include <QMutex>
+#include <QSharedPointer>
+#include "CharacterSet.h"
+
+/**
+ * CharacterSetRegistry - Interns character sets per language
+ *
+ * DESIGN PATTERN: Singleton Pattern (Creational)
+ * Purpose: Every skill of a language usually ships the same alphabet. The registry
+ * stores each distinct (language, characters) set once and hands out a small integer
+ * id; exercises keep only that id.
+ *
+ * Ids are never reused and sets are never freed, so an id held by an exercise of an
+ * old content snapshot stays valid after a reload. Thread-safe.
+ *
+ * Usage: int id = CharacterSetRegistry::getInstance().intern("Nepali", characters);
+ *        const CharacterSet* set = CharacterSetRegistry::getInstance().get(id);
+ */
+class CharacterSetRegistry {
+public:
+    static const int kNoCharacterSet = -1;
+
+    /**
+     * Get the singleton instance
+     * @return Reference to the single CharacterSetRegistry instance
+     */
+    static CharacterSetRegistry& getInstance();
+
+    // Delete copy constructor and assignment operator (Singleton)
+    CharacterSetRegistry(const CharacterSetRegistry&) = delete;
+    CharacterSetRegistry& operator=(const CharacterSetRegistry&) = delete;
+
+    /**
+     * Return the id of an identical set of the same language, registering it if new
+     * @return kNoCharacterSet if characters is empty
+     */
+    int intern(const QString& language, const QStringList& characters);
+
+    /**
+     * @return The set for id, or nullptr for kNoCharacterSet / unknown ids
+     */
+    const CharacterSet* get(int id) const;
+
+    QString getLanguage(int id) const;
+    int count() const;
+
+private:
+    CharacterSetRegistry();
+
+    struct Entry {
+        QString language;
+        QSharedPointer<const CharacterSet> characterSet;
+    };
+
+    mutable QMutex mutex;
+    QVector<Entry> entries;                 // Indexed by id
+    QMultiHash<QString, int> idsByLanguage;
+};
+
+#endif // CHARACTERSETREGISTRY_H
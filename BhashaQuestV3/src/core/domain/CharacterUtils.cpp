@@ -1,5 +1,6 @@
 #include "CharacterUtils.h"
 #include <QRandomGenerator>
+#include <QVector>
 #include <QDebug>
 #include <algorithm>
 #include <stdexcept>
@@ -34,27 +35,35 @@ QStringList CharacterUtils::extractUniqueCharacters(const QString& text) {
 
 QStringList CharacterUtils::getRandomDistractors(
     const QString& sourceText,
-    const QStringList& languageCharacterSet,
+    const CharacterSet& languageCharacterSet,
     int count) {
 
-    QStringList sourceCharacters = extractUniqueCharacters(sourceText);
-    QStringList availableDistractors;
+    // Code points of the source text (answers are a handful of characters)
+    const QList<uint> sourceCodePoints = sourceText.toUcs4();
 
-    // Build list of characters NOT in source text
-    for (const QString& ch : languageCharacterSet) {
-        if (!sourceCharacters.contains(ch)) {
-            availableDistractors.append(ch);
+    // Indices into the set of characters NOT in source text
+    QVector<int> availableDistractors;
+    availableDistractors.reserve(languageCharacterSet.size());
+    for (int i = 0; i < languageCharacterSet.codePointCount(); ++i) {
+        if (!sourceCodePoints.contains(languageCharacterSet.codePointAt(i))) {
+            availableDistractors.append(i);
+        }
+    }
+    for (int i = languageCharacterSet.codePointCount(); i < languageCharacterSet.size(); ++i) {
+        if (!sourceText.contains(languageCharacterSet.characterAt(i))) {
+            availableDistractors.append(i);
         }
     }
 
     QStringList selectedDistractors;
     QRandomGenerator generator = QRandomGenerator::securelySeeded();
 
-    // Select random distractor characters
-    for (int i = 0; i < count && availableDistractors.length() > 0; ++i) {
-        int randomIndex = generator.bounded(availableDistractors.length());
-        QString distractor = availableDistractors.takeAt(randomIndex);
-        selectedDistractors.append(distractor);
+    // Select random distractor characters (partial Fisher-Yates over the indices)
+    const int picks = qMin(count, availableDistractors.size());
+    for (int i = 0; i < picks; ++i) {
+        const int randomIndex = i + generator.bounded(availableDistractors.size() - i);
+        std::swap(availableDistractors[i], availableDistractors[randomIndex]);
+        selectedDistractors.append(languageCharacterSet.characterAt(availableDistractors.at(i)));
     }
 
     return selectedDistractors;
@@ -62,7 +71,7 @@ QStringList CharacterUtils::getRandomDistractors(
 
 QStringList CharacterUtils::generateCharacterBank(
     const QString& correctAnswer,
-    const QStringList& languageCharacterSet) {
+    const CharacterSet& languageCharacterSet) {
 
     // Validate inputs
     if (correctAnswer.isEmpty() || languageCharacterSet.isEmpty()) {
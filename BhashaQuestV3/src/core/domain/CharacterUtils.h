@@ -3,6 +3,7 @@
 
 #include <QString>
 #include <QStringList>
+#include "CharacterSet.h"
 
 /**
  * CharacterUtils - Utility functions for character selection exercises
@@ -11,6 +12,9 @@
  * - Generating character banks (n+3 characters) for selection exercises
  * - Extracting unique characters from strings
  * - Managing language-specific character sets
+ *
+ * Language character sets are taken in their compact CharacterSet form, so
+ * distractor selection never expands them into string lists.
  */
 class CharacterUtils {
 public:
@@ -26,7 +30,7 @@ public:
      */
     static QStringList generateCharacterBank(
         const QString& correctAnswer,
-        const QStringList& languageCharacterSet
+        const CharacterSet& languageCharacterSet
     );
 
     /**
@@ -62,7 +66,7 @@ public:
      */
     static QStringList getRandomDistractors(
         const QString& sourceText,
-        const QStringList& languageCharacterSet,
+        const CharacterSet& languageCharacterSet,
         int count
     );
 };
@@ -0,0 +1,20 @@
+#include "Clock.h"
+
+Clock::Clock() {
+}
+
+QDate Clock::today() const {
+    return simulatedDate.isValid() ? simulatedDate : QDate::currentDate();
+}
+
+void Clock::advance(int days) {
+    simulatedDate = today().addDays(days);
+}
+
+void Clock::setToday(const QDate& date) {
+    simulatedDate = date;
+}
+
+void Clock::reset() {
+    simulatedDate = QDate();
+}
@@ -0,0 +1,48 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <QDate>
+
+/**
+ * Clock - The app's idea of "today"
+ *
+ * Profile (streaks) and SRSScheduler (due dates) ask one shared Clock for the
+ * date instead of calling QDate::currentDate() themselves. It follows the real
+ * date until time travel is used; after that it stays on the simulated date,
+ * so the streak and the review queue move forward together.
+ * The headless SRS simulator drives a Clock the same way to replay years
+ * of reviews in seconds.
+ *
+ * Not thread-safe: advance it only while nothing is reading it.
+ */
+class Clock {
+public:
+    Clock();
+
+    /**
+     * Current date (simulated if time travel is active, otherwise real date)
+     */
+    QDate today() const;
+
+    /**
+     * Advance the simulated date by N days, starting from the real date
+     */
+    void advance(int days = 1);
+
+    /**
+     * Jump to a simulated date; an invalid date goes back to the real date
+     */
+    void setToday(const QDate& date);
+
+    /**
+     * Go back to the real date
+     */
+    void reset();
+
+    bool isSimulated() const { return simulatedDate.isValid(); }
+
+private:
+    QDate simulatedDate;                    // Null while following the real date
+};
+
+#endif // CLOCK_H
@@ -0,0 +1,283 @@
+#include "ClusterDistance.h"
+#include <QTextBoundaryFinder>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+// ========== Confusion Tables ==========
+
+const int kEditCost = ClusterDistance::kEditCost;
+const int kBlockSize = 128;             // Devanagari and Kannada are 128-unit blocks
+const int kMaxClusterUnits = 8;         // Longer clusters are priced as plain edits
+const int kMinIndelCost = 1;            // A lone nukta, the cheapest cluster to insert or drop
+
+struct ConfusablePair {
+    char16_t first;
+    char16_t second;
+    quint8 cost;
+};
+
+struct MarkCost {
+    char16_t unit;
+    quint8 cost;                        // Cost of inserting or dropping the mark
+};
+
+struct ScriptCosts {
+    char16_t blockStart;
+    quint8 substitution[kBlockSize][kBlockSize];
+    quint8 indel[kBlockSize];
+};
+
+template <std::size_t PairCount, std::size_t MarkCount>
+constexpr ScriptCosts buildScriptCosts(char16_t blockStart,
+                                       const ConfusablePair (&pairs)[PairCount],
+                                       const MarkCost (&marks)[MarkCount]) {
+    ScriptCosts costs{};
+    costs.blockStart = blockStart;
+    for (int i = 0; i < kBlockSize; ++i) {
+        for (int j = 0; j < kBlockSize; ++j) {
+            costs.substitution[i][j] = (i == j) ? 0 : kEditCost;
+        }
+        costs.indel[i] = kEditCost;
+    }
+    for (const ConfusablePair& pair : pairs) {
+        costs.substitution[pair.first - blockStart][pair.second - blockStart] = pair.cost;
+        costs.substitution[pair.second - blockStart][pair.first - blockStart] = pair.cost;
+    }
+    for (const MarkCost& mark : marks) {
+        costs.indel[mark.unit - blockStart] = mark.cost;
+    }
+    return costs;
+}
+
+// Nepali (Devanagari, U+0900-U+097F). Costs are in quarter edits.
+constexpr ConfusablePair kDevanagariPairs[] = {
+    // Short/long vowels and vowel signs
+    {0x093F, 0x0940, 1}, {0x0941, 0x0942, 1},   // ि ी, ु ू
+    {0x0907, 0x0908, 1}, {0x0909, 0x090A, 1},   // इ ई, उ ऊ
+    {0x0905, 0x0906, 2}, {0x090F, 0x0910, 2},   // अ आ, ए ऐ
+    {0x0913, 0x0914, 2}, {0x0947, 0x0948, 2},   // ओ औ, े ै
+    {0x094B, 0x094C, 2},                        // ो ौ
+    // Vowel sign typed as the independent vowel
+    {0x093E, 0x0906, 2}, {0x093F, 0x0907, 2},   // ा आ, ि इ
+    {0x0940, 0x0908, 2}, {0x0941, 0x0909, 2},   // ी ई, ु उ
+    {0x0942, 0x090A, 2}, {0x0947, 0x090F, 2},   // ू ऊ, े ए
+    // Nasalization
+    {0x0901, 0x0902, 1},                        // ँ ं
+    // Aspirated/unaspirated
+    {0x0915, 0x0916, 2}, {0x0917, 0x0918, 2},   // क ख, ग घ
+    {0x091A, 0x091B, 2}, {0x091C, 0x091D, 2},   // च छ, ज झ
+    {0x091F, 0x0920, 2}, {0x0921, 0x0922, 2},   // ट ठ, ड ढ
+    {0x0924, 0x0925, 2}, {0x0926, 0x0927, 2},   // त थ, द ध
+    {0x092A, 0x092B, 2}, {0x092C, 0x092D, 2},   // प फ, ब भ
+    // Retroflex/dental
+    {0x091F, 0x0924, 2}, {0x0920, 0x0925, 2},   // ट त, ठ थ
+    {0x0921, 0x0926, 2}, {0x0922, 0x0927, 2},   // ड द, ढ ध
+    {0x0923, 0x0928, 2},                        // ण न
+    // Sibilants and b/v, which spoken Nepali does not tell apart
+    {0x0936, 0x0937, 1}, {0x0936, 0x0938, 2},   // श ष, श स
+    {0x0937, 0x0938, 2}, {0x092C, 0x0935, 2},   // ष स, ब व
+};
+
+constexpr MarkCost kDevanagariMarks[] = {
+    {0x093C, 1},                                // Nukta
+    {0x0901, 2}, {0x0902, 2},                   // Chandrabindu, anusvara
+    {0x0903, 2},                                // Visarga
+    {0x094D, 2},                                // Virama (half form vs full letter)
+};
+
+// Kannada (U+0C80-U+0CFF)
+constexpr ConfusablePair kKannadaPairs[] = {
+    // Short/long vowels and vowel signs
+    {0x0CBF, 0x0CC0, 1}, {0x0CC1, 0x0CC2, 1},   // ಿ ೀ, ು ೂ
+    {0x0CC6, 0x0CC7, 1}, {0x0CCA, 0x0CCB, 1},   // ೆ ೇ, ೊ ೋ
+    {0x0C87, 0x0C88, 1}, {0x0C89, 0x0C8A, 1},   // ಇ ಈ, ಉ ಊ
+    {0x0C8E, 0x0C8F, 1}, {0x0C92, 0x0C93, 1},   // ಎ ಏ, ಒ ಓ
+    {0x0C85, 0x0C86, 2}, {0x0CC6, 0x0CC8, 2},   // ಅ ಆ, ೆ ೈ
+    // Aspirated/unaspirated
+    {0x0C95, 0x0C96, 2}, {0x0C97, 0x0C98, 2},   // ಕ ಖ, ಗ ಘ
+    {0x0C9A, 0x0C9B, 2}, {0x0C9C, 0x0C9D, 2},   // ಚ ಛ, ಜ ಝ
+    {0x0C9F, 0x0CA0, 2}, {0x0CA1, 0x0CA2, 2},   // ಟ ಠ, ಡ ಢ
+    {0x0CA4, 0x0CA5, 2}, {0x0CA6, 0x0CA7, 2},   // ತ ಥ, ದ ಧ
+    {0x0CAA, 0x0CAB, 2}, {0x0CAC, 0x0CAD, 2},   // ಪ ಫ, ಬ ಭ
+    // Retroflex/dental
+    {0x0C9F, 0x0CA4, 2}, {0x0CA1, 0x0CA6, 2},   // ಟ ತ, ಡ ದ
+    {0x0CA3, 0x0CA8, 2}, {0x0CB2, 0x0CB3, 2},   // ಣ ನ, ಲ ಳ
+    {0x0CB0, 0x0CB1, 1},                        // ರ ಱ
+    // Sibilants
+    {0x0CB6, 0x0CB7, 1}, {0x0CB6, 0x0CB8, 2},   // ಶ ಷ, ಶ ಸ
+    {0x0CB7, 0x0CB8, 2},                        // ಷ ಸ
+};
+
+constexpr MarkCost kKannadaMarks[] = {
+    {0x0CBC, 1},                                // Nukta
+    {0x0C82, 2}, {0x0C83, 2},                   // Anusvara, visarga
+    {0x0CCD, 2},                                // Virama
+};
+
+constexpr ScriptCosts kDevanagariCosts = buildScriptCosts(0x0900, kDevanagariPairs, kDevanagariMarks);
+constexpr ScriptCosts kKannadaCosts = buildScriptCosts(0x0C80, kKannadaPairs, kKannadaMarks);
+
+static_assert(kDevanagariCosts.substitution[0x3F][0x40] == 1, "Vowel length slips should be a quarter edit");
+static_assert(kDevanagariCosts.substitution[0x15][0x2E] == kEditCost, "Unrelated consonants should be a full edit");
+static_assert(kKannadaCosts.indel[0x4D] == 2, "Kannada virama should be half an edit");
+
+const ScriptCosts* costsFor(char16_t unit) {
+    switch (unit & ~char16_t(kBlockSize - 1)) {
+        case 0x0900:
+            return &kDevanagariCosts;
+        case 0x0C80:
+            return &kKannadaCosts;
+        default:
+            return nullptr;
+    }
+}
+
+int unitSubstitution(char16_t a, char16_t b) {
+    if (a == b) {
+        return 0;
+    }
+    const ScriptCosts* costs = costsFor(a);
+    if (costs && costs == costsFor(b)) {
+        return costs->substitution[a - costs->blockStart][b - costs->blockStart];
+    }
+    return kEditCost;
+}
+
+int unitIndel(char16_t unit) {
+    const ScriptCosts* costs = costsFor(unit);
+    return costs ? costs->indel[unit - costs->blockStart] : kEditCost;
+}
+
+} // namespace
+
+// ========== ClusterText ==========
+
+ClusterText::ClusterText()
+    : weightedScript(false) {
+    bounds.append(0);
+}
+
+ClusterText::ClusterText(const QString& text)
+    : source(text)
+    , weightedScript(false)
+{
+    bounds.reserve(text.length() + 1);
+    bounds.append(0);
+
+    QTextBoundaryFinder finder(QTextBoundaryFinder::Grapheme, source);
+    while (finder.toNextBoundary() > 0) {
+        bounds.append(static_cast<int>(finder.position()));
+    }
+    if (bounds.last() != source.length()) {
+        bounds.append(source.length());
+    }
+
+    // A cluster is inserted or deleted unit by unit, so a dropped mark stays cheap
+    // and a dropped conjunct costs as many edits as it has letters
+    const char16_t* units = reinterpret_cast<const char16_t*>(source.utf16());
+    indelCosts.reserve(bounds.size() - 1);
+    for (int i = 0; i + 1 < bounds.size(); ++i) {
+        int cost = 0;
+        for (int unit = bounds.at(i); unit < bounds.at(i + 1); ++unit) {
+            cost += unitIndel(units[unit]);
+            weightedScript = weightedScript || costsFor(units[unit]) != nullptr;
+        }
+        indelCosts.append(cost);
+    }
+}
+
+// ========== Distance ==========
+
+int ClusterDistance::substitutionCost(const char16_t* a, int aLength, const char16_t* b, int bLength) {
+    if (aLength == bLength && std::equal(a, a + aLength, b)) {
+        return 0;
+    }
+    if (aLength > kMaxClusterUnits || bLength > kMaxClusterUnits) {
+        // Never cheaper than the plain edits between the two clusters
+        return std::max(aLength, bLength) * kEditCost;
+    }
+
+    // Weighted Levenshtein over the few units of the two clusters
+    int row[kMaxClusterUnits + 1];
+    row[0] = 0;
+    for (int j = 1; j <= bLength; ++j) {
+        row[j] = row[j - 1] + unitIndel(b[j - 1]);
+    }
+    for (int i = 1; i <= aLength; ++i) {
+        const int dropA = unitIndel(a[i - 1]);
+        int diagonal = row[0];
+        row[0] += dropA;
+        for (int j = 1; j <= bLength; ++j) {
+            const int above = row[j];
+            row[j] = std::min({diagonal + unitSubstitution(a[i - 1], b[j - 1]),
+                               above + dropA,
+                               row[j - 1] + unitIndel(b[j - 1])});
+            diagonal = above;
+        }
+    }
+    // Not capped at one edit: an unrelated syllable costs every letter it changes,
+    // so only the listed confusables come out cheaper than plain Levenshtein
+    return row[bLength];
+}
+
+int ClusterDistance::boundedDistance(const ClusterText& a, const ClusterText& b, int maxCost) {
+    const int n = a.size();
+    const int m = b.size();
+    const int outOfReach = maxCost + 1;
+
+    // Every cluster inserted or deleted costs at least kMinIndelCost, so
+    // alignments leaving the band |i - j| <= maxCost / kMinIndelCost are
+    // already too expensive
+    const int band = maxCost / kMinIndelCost;
+    if (std::abs(n - m) > band) {
+        return outOfReach;
+    }
+
+    thread_local std::vector<int> previousRow;
+    thread_local std::vector<int> currentRow;
+    std::vector<int>& previous = previousRow;
+    std::vector<int>& current = currentRow;
+    previous.assign(m + 1, outOfReach);
+    current.assign(m + 1, outOfReach);
+
+    previous[0] = 0;
+    for (int j = 1; j <= std::min(m, band); ++j) {
+        previous[j] = std::min(previous[j - 1] + b.clusterIndelCost(j - 1), outOfReach);
+    }
+
+    int firstColumn = 0;                // Cost of deleting the first i clusters of a
+    for (int i = 1; i <= n; ++i) {
+        const int first = std::max(1, i - band);
+        const int last = std::min(m, i + band);
+        const int dropA = a.clusterIndelCost(i - 1);
+
+        std::fill(current.begin(), current.end(), outOfReach);
+        firstColumn = std::min(firstColumn + dropA, outOfReach);
+        if (i <= band) {
+            current[0] = firstColumn;
+        }
+
+        int rowMinimum = current[0];
+        for (int j = first; j <= last; ++j) {
+            const int replace = previous[j - 1]
+                + substitutionCost(a.cluster(i - 1), a.clusterLength(i - 1),
+                                   b.cluster(j - 1), b.clusterLength(j - 1));
+            const int value = std::min({replace, previous[j] + dropA,
+                                        current[j - 1] + b.clusterIndelCost(j - 1), outOfReach});
+            current[j] = value;
+            rowMinimum = std::min(rowMinimum, value);
+        }
+
+        // Costs never decrease along a path: the whole band is out of reach
+        if (rowMinimum > maxCost) {
+            return outOfReach;
+        }
+        std::swap(previous, current);
+    }
+
+    return std::min(previous[m], outOfReach);
+}
@@ -0,0 +1,84 @@
+#ifndef CLUSTERDISTANCE_H
+#define CLUSTERDISTANCE_H
+
+#include <QString>
+#include <QVector>
+
+/**
+ * ClusterText - A string split into grapheme clusters
+ *
+ * Devanagari and Kannada syllables are several UTF-16 units (consonant, vowel
+ * sign, virama, nukta...) that read as one letter. Segmenting once lets the
+ * weighted distance treat each cluster as one symbol.
+ */
+class ClusterText {
+public:
+    ClusterText();
+    explicit ClusterText(const QString& text);
+
+    int size() const { return bounds.size() - 1; }      // Number of clusters
+    const QString& text() const { return source; }
+
+    const char16_t* cluster(int index) const {
+        return reinterpret_cast<const char16_t*>(source.utf16()) + bounds.at(index);
+    }
+    int clusterLength(int index) const { return bounds.at(index + 1) - bounds.at(index); }
+
+    // Cost of inserting or deleting cluster index: the sum of its units' costs
+    int clusterIndelCost(int index) const { return indelCosts.at(index); }
+
+    /**
+     * True if any unit belongs to a script with a confusion table
+     * (Devanagari, Kannada); for other text the weighted distance adds nothing
+     */
+    bool hasWeightedScript() const { return weightedScript; }
+
+private:
+    QString source;
+    QVector<int> bounds;        // Cluster i is [bounds[i], bounds[i + 1])
+    QVector<int> indelCosts;    // Per cluster, in ClusterDistance::kEditCost units
+    bool weightedScript;
+};
+
+/**
+ * ClusterDistance - Confusable-aware edit distance over grapheme clusters
+ *
+ * Purpose: Plain Levenshtein on UTF-16 units charges a whole typo for ि vs ी
+ * (a vowel length slip any learner makes) and several typos for one wrong
+ * conjunct. This distance works on clusters and prices substitutions with
+ * per-script confusion tables generated at compile time (constexpr) from
+ * lists of confusable pairs:
+ * - Short/long vowels and vowel signs (ि/ी, ु/ू, ಿ/ೀ, ೆ/ೇ): a quarter edit
+ * - Aspirated/unaspirated (क/ख, ದ/ಧ), retroflex/dental (ट/त, ಳ/ಲ), sibilants
+ *   (श/ष/स), nasal marks: half an edit
+ * - Dropped nukta, anusvara or virama: a quarter to half an edit
+ * - Anything else: one edit, as before
+ *
+ * Costs are in quarter edits (kEditCost per full edit). Replacing one cluster
+ * by another costs the weighted distance between their units, and inserting
+ * or deleting a cluster costs the sum of its units. Nothing is capped, so only
+ * the listed confusables come out cheaper than plain Levenshtein: weighted
+ * acceptance adds confusable slips to the plain matches, never unrelated words.
+ *
+ * Only used after the plain bit-parallel check rejects an answer, and only for
+ * answers written in a script that has a table.
+ */
+class ClusterDistance {
+public:
+    static const int kEditCost = 4;
+
+    /**
+     * Weighted distance between a and b, computed only as far as needed to
+     * tell whether it is at most maxCost (in kEditCost units)
+     * @return The distance if <= maxCost, otherwise maxCost + 1
+     */
+    static int boundedDistance(const ClusterText& a, const ClusterText& b, int maxCost);
+
+    /**
+     * Cost of replacing one cluster by another (0 if equal); clusters longer than
+     * a syllable are priced as plain edits
+     */
+    static int substitutionCost(const char16_t* a, int aLength, const char16_t* b, int bLength);
+};
+
+#endif // CLUSTERDISTANCE_H
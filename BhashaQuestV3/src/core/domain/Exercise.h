@@ -3,7 +3,7 @@
 
 #include <QString>
 #include <QStringList>
-#include <QWidget>
+#include "ExerciseKind.h"
 
 /**
  * Exercise - Abstract base class for all exercise types
@@ -15,11 +15,15 @@ class Exercise {
 protected:
     QString id;                 // Unique identifier for this exercise
     QString type;               // Exercise type ("MCQ", "Translate", "TileOrder")
+    ExerciseKind kind;          // Same type as a tag, set by the concrete class
     QString prompt;             // Question or instruction text
     QString skillId;            // Associated skill ID
     int difficulty;             // Difficulty level (1-5)
     QString audioFile;          // Optional audio file for pronunciation
 
+    explicit Exercise(ExerciseKind kind = ExerciseKind::Unknown)
+        : kind(kind) {}
+
 public:
     virtual ~Exercise() = default;
 
@@ -41,10 +45,9 @@ public:
     virtual QString getType() const = 0;
 
     /**
-     * Render UI elements for this exercise type
-     * Returns a widget containing the exercise UI
+     * Get the exercise type tag (non-virtual; use in hot paths instead of getType())
      */
-    virtual QWidget* renderUI(QWidget* parent = nullptr) = 0;
+    ExerciseKind getKind() const { return kind; }
 
     // Getters
     QString getId() const { return id; }
@@ -0,0 +1,53 @@
+#include "ExerciseArena.h"
+#include <cstdint>
+
+ExerciseArena::ExerciseArena(std::size_t blockSize)
+    : blockSize(blockSize)
+    , cursor(nullptr)
+    , blockEnd(nullptr)
+    , reservedBytes(0)
+{
+}
+
+ExerciseArena::~ExerciseArena() {
+    clear();
+}
+
+void ExerciseArena::clear() {
+    // Run destructors so QString/QStringList members release their data
+    for (int i = objects.size() - 1; i >= 0; --i) {
+        objects[i]->~Exercise();
+    }
+    objects.clear();
+
+    for (char* block : blocks) {
+        ::operator delete(block);
+    }
+    blocks.clear();
+
+    cursor = nullptr;
+    blockEnd = nullptr;
+    reservedBytes = 0;
+}
+
+void* ExerciseArena::allocate(std::size_t size, std::size_t alignment) {
+    if (cursor) {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(cursor);
+        const std::uintptr_t aligned = (address + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+        if (aligned + size <= reinterpret_cast<std::uintptr_t>(blockEnd)) {
+            cursor = reinterpret_cast<char*>(aligned + size);
+            return reinterpret_cast<char*>(aligned);
+        }
+    }
+
+    // Start a new block; oversized objects get a block of their own
+    // (::operator new returns memory aligned for any fundamental type)
+    const std::size_t newBlockSize = size > blockSize ? size : blockSize;
+    char* block = static_cast<char*>(::operator new(newBlockSize));
+    blocks.append(block);
+    reservedBytes += newBlockSize;
+
+    cursor = block + size;
+    blockEnd = block + newBlockSize;
+    return block;
+}
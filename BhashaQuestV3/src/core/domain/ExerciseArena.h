@@ -0,0 +1,63 @@
+#ifndef EXERCISEARENA_H
+#define EXERCISEARENA_H
+
+#include "Exercise.h"
+#include <QVector>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * ExerciseArena - Bump allocator for Exercise objects
+ *
+ * Purpose: ContentRepository gives each skill one arena. All exercises of the
+ * skill are placed back to back in a few large blocks instead of one heap
+ * allocation each, so walking a sequence touches adjacent memory and tearing
+ * a skill down is a single bulk release.
+ *
+ * Objects are destroyed (in reverse creation order) by clear() or the
+ * destructor; never call delete on a pointer returned by create().
+ */
+class ExerciseArena {
+public:
+    explicit ExerciseArena(std::size_t blockSize = 16 * 1024);
+    ~ExerciseArena();
+
+    ExerciseArena(const ExerciseArena&) = delete;
+    ExerciseArena& operator=(const ExerciseArena&) = delete;
+
+    /**
+     * Construct a concrete exercise inside the arena
+     * @return Pointer owned by the arena
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_base_of<Exercise, T>::value,
+                      "ExerciseArena only holds Exercise subclasses");
+        void* memory = allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(std::forward<Args>(args)...);
+        objects.append(object);
+        return object;
+    }
+
+    /**
+     * Destroy every object and release all blocks at once
+     */
+    void clear();
+
+    int objectCount() const { return objects.size(); }
+    std::size_t bytesReserved() const { return reservedBytes; }
+
+private:
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    std::size_t blockSize;
+    QVector<char*> blocks;
+    QVector<Exercise*> objects;     // Creation order, for destructor calls
+    char* cursor;                   // Next free byte in the current block
+    char* blockEnd;
+    std::size_t reservedBytes;
+};
+
+#endif // EXERCISEARENA_H
@@ -2,120 +2,110 @@
 #include "MCQExercise.h"
 #include "TranslateExercise.h"
 #include "TileOrderExercise.h"
-#include <QJsonArray>
+#include <utility>
 
-Exercise* ExerciseFactory::createExercise(const QString& type, const QJsonObject& spec) {
+namespace {
+
+// Place the exercise in the arena when one is supplied, otherwise on the heap
+template <typename T, typename... Args>
+T* construct(ExerciseArena* arena, Args&&... args) {
+    if (arena) {
+        return arena->create<T>(std::forward<Args>(args)...);
+    }
+    return new T(std::forward<Args>(args)...);
+}
+
+} // namespace
+
+Exercise* ExerciseFactory::createExercise(const QString& type, const QJsonObject& spec,
+                                          ExerciseArena* arena) {
+    ExerciseSpec exerciseSpec = ExerciseSpec::fromJson(spec);
+    exerciseSpec.type = type;
+    return createExercise(exerciseSpec, arena);
+}
+
+Exercise* ExerciseFactory::createExercise(const ExerciseSpec& spec, ExerciseArena* arena) {
     // Factory Pattern: Route to appropriate creation method based on type
-    if (type == "MCQ") {
-        return createMCQ(spec);
-    } else if (type == "Translate") {
-        return createTranslate(spec);
-    } else if (type == "TileOrder") {
-        return createTileOrder(spec);
+    switch (exerciseKindFromType(spec.type)) {
+        case ExerciseKind::MCQ:
+            return createMCQ(spec, arena);
+        case ExerciseKind::Translate:
+            return createTranslate(spec, arena);
+        case ExerciseKind::TileOrder:
+            return createTileOrder(spec, arena);
+        case ExerciseKind::Unknown:
+            break;
     }
 
     // Unknown type - return nullptr
     return nullptr;
 }
 
-Exercise* ExerciseFactory::createMCQ(const QJsonObject& spec) {
-    QString id = spec["id"].toString();
-    QString prompt = spec["prompt"].toString();
-
-    // Extract options array
-    QStringList options;
-    QJsonArray optionsArray = spec["options"].toArray();
-    for (const QJsonValue& value : optionsArray) {
-        options.append(value.toString());
-    }
-
-    int correctIndex = spec["correctIndex"].toInt(0);
+bool ExerciseFactory::isSupportedType(const QString& type) {
+    return exerciseKindFromType(type) != ExerciseKind::Unknown;
+}
 
+Exercise* ExerciseFactory::createMCQ(const ExerciseSpec& spec, ExerciseArena* arena) {
     // Create and configure MCQ exercise
-    MCQExercise* exercise = new MCQExercise(id, prompt, options, correctIndex);
+    MCQExercise* exercise = construct<MCQExercise>(arena, spec.id, spec.prompt,
+                                                   spec.options, spec.correctIndex);
 
     // Set optional fields
-    if (spec.contains("skillId")) {
-        exercise->setSkillId(spec["skillId"].toString());
+    if (!spec.skillId.isEmpty()) {
+        exercise->setSkillId(spec.skillId);
     }
-    if (spec.contains("difficulty")) {
-        exercise->setDifficulty(spec["difficulty"].toInt(1));
+    if (spec.difficulty > 0) {
+        exercise->setDifficulty(spec.difficulty);
     }
-    if (spec.contains("audioFile")) {
-        exercise->setAudioFile(spec["audioFile"].toString());
+    if (!spec.audioFile.isEmpty()) {
+        exercise->setAudioFile(spec.audioFile);
     }
 
     return exercise;
 }
 
-Exercise* ExerciseFactory::createTranslate(const QJsonObject& spec) {
-    QString id = spec["id"].toString();
-    QString englishPhrase = spec["englishPhrase"].toString();
-
-    // Extract correct answers array (supports multiple valid answers)
-    QStringList correctAnswers;
-    QJsonArray answersArray = spec["correctAnswers"].toArray();
-    for (const QJsonValue& value : answersArray) {
-        correctAnswers.append(value.toString());
-    }
+Exercise* ExerciseFactory::createTranslate(const ExerciseSpec& spec, ExerciseArena* arena) {
+    QString targetLanguage = spec.targetLanguage.isEmpty() ? QString("Nepali") : spec.targetLanguage;
 
-    QString targetLanguage = spec["targetLanguage"].toString("Nepali");
-
-    // Create and configure Translate exercise
-    TranslateExercise* exercise = new TranslateExercise(id, englishPhrase, correctAnswers, targetLanguage);
+    // Create and configure Translate exercise (supports multiple valid answers)
+    TranslateExercise* exercise = construct<TranslateExercise>(arena, spec.id, spec.englishPhrase,
+                                                               spec.correctAnswers, targetLanguage);
 
     // Set optional fields
-    if (spec.contains("skillId")) {
-        exercise->setSkillId(spec["skillId"].toString());
+    if (!spec.skillId.isEmpty()) {
+        exercise->setSkillId(spec.skillId);
     }
-    if (spec.contains("difficulty")) {
-        exercise->setDifficulty(spec["difficulty"].toInt(2));
+    if (spec.difficulty > 0) {
+        exercise->setDifficulty(spec.difficulty);
     }
-    if (spec.contains("prompt")) {
-        exercise->setPrompt(spec["prompt"].toString());
+    if (!spec.prompt.isEmpty()) {
+        exercise->setPrompt(spec.prompt);
     }
-    if (spec.contains("audioFile")) {
-        exercise->setAudioFile(spec["audioFile"].toString());
+    if (!spec.audioFile.isEmpty()) {
+        exercise->setAudioFile(spec.audioFile);
     }
 
     return exercise;
 }
 
-Exercise* ExerciseFactory::createTileOrder(const QJsonObject& spec) {
-    QString id = spec["id"].toString();
-    QString prompt = spec["prompt"].toString();
-
-    // Extract tiles array
-    QStringList tiles;
-    QJsonArray tilesArray = spec["tiles"].toArray();
-    for (const QJsonValue& value : tilesArray) {
-        tiles.append(value.toString());
-    }
-
-    // Extract correct order array
-    QStringList correctOrder;
-    QJsonArray orderArray = spec["correctOrder"].toArray();
-    for (const QJsonValue& value : orderArray) {
-        correctOrder.append(value.toString());
-    }
-
+Exercise* ExerciseFactory::createTileOrder(const ExerciseSpec& spec, ExerciseArena* arena) {
     // Create and configure TileOrder exercise
-    TileOrderExercise* exercise = new TileOrderExercise(id, prompt, tiles, correctOrder);
+    TileOrderExercise* exercise = construct<TileOrderExercise>(arena, spec.id, spec.prompt,
+                                                               spec.tiles, spec.correctOrder);
 
     // Set optional fields
-    if (spec.contains("skillId")) {
-        exercise->setSkillId(spec["skillId"].toString());
+    if (!spec.skillId.isEmpty()) {
+        exercise->setSkillId(spec.skillId);
     }
-    if (spec.contains("difficulty")) {
-        exercise->setDifficulty(spec["difficulty"].toInt(3));
+    if (spec.difficulty > 0) {
+        exercise->setDifficulty(spec.difficulty);
     }
-
-    if (spec.contains("audioFile")) {
-        exercise->setAudioFile(spec["audioFile"].toString());
+    if (!spec.audioFile.isEmpty()) {
+        exercise->setAudioFile(spec.audioFile);
     }
 
     // Optionally shuffle tiles if requested
-    if (spec.contains("shuffled") && spec["shuffled"].toBool()) {
+    if (spec.shuffled) {
         exercise->shuffle();
     }
 
@@ -2,6 +2,8 @@
 #define EXERCISEFACTORY_H
 
 #include "Exercise.h"
+#include "ExerciseSpec.h"
+#include "ExerciseArena.h"
 #include <QJsonObject>
 #include <QString>
 
@@ -22,15 +24,32 @@ public:
      * Create an Exercise instance from JSON specification
      * @param type - Exercise type ("MCQ", "Translate", "TileOrder")
      * @param spec - JSON object containing exercise data
-     * @return Pointer to created Exercise (caller owns memory)
+     * @param arena - Optional arena to place the exercise in
+     * @return Pointer to created Exercise (caller owns memory, or the arena does if given)
      */
-    static Exercise* createExercise(const QString& type, const QJsonObject& spec);
+    static Exercise* createExercise(const QString& type, const QJsonObject& spec,
+                                    ExerciseArena* arena = nullptr);
+
+    /**
+     * Create an Exercise instance from a format-independent specification
+     * Used by the binary content pack loader (no JSON involved)
+     * @param spec - Exercise description; spec.type selects the concrete class
+     * @param arena - Optional arena to place the exercise in
+     * @return Pointer to created Exercise (caller owns memory, or the arena does if given)
+     */
+    static Exercise* createExercise(const ExerciseSpec& spec, ExerciseArena* arena = nullptr);
+
+    /**
+     * Check whether the factory can build exercises of the given type
+     * Lets the repository count exercises without constructing them
+     */
+    static bool isSupportedType(const QString& type);
 
 private:
     // Private helper methods for creating specific exercise types
-    static Exercise* createMCQ(const QJsonObject& spec);
-    static Exercise* createTranslate(const QJsonObject& spec);
-    static Exercise* createTileOrder(const QJsonObject& spec);
+    static Exercise* createMCQ(const ExerciseSpec& spec, ExerciseArena* arena);
+    static Exercise* createTranslate(const ExerciseSpec& spec, ExerciseArena* arena);
+    static Exercise* createTileOrder(const ExerciseSpec& spec, ExerciseArena* arena);
 };
 
 #endif // EXERCISEFACTORY_H
@@ -0,0 +1,34 @@
+#ifndef EXERCISEKIND_H
+#define EXERCISEKIND_H
+
+#include <QString>
+
+/**
+ * ExerciseKind - Compact type tag of an exercise
+ *
+ * Lets callers dispatch with a switch instead of comparing type strings or
+ * using dynamic_cast. Values match the kind byte of the content pack.
+ */
+enum class ExerciseKind : quint8 {
+    Unknown = 0,
+    MCQ = 1,
+    Translate = 2,
+    TileOrder = 3
+};
+
+/**
+ * Map a content type string ("MCQ", "Translate", "TileOrder") to its kind
+ * @return ExerciseKind::Unknown for unsupported types
+ */
+inline ExerciseKind exerciseKindFromType(const QString& type) {
+    if (type == QLatin1String("MCQ")) {
+        return ExerciseKind::MCQ;
+    } else if (type == QLatin1String("Translate")) {
+        return ExerciseKind::Translate;
+    } else if (type == QLatin1String("TileOrder")) {
+        return ExerciseKind::TileOrder;
+    }
+    return ExerciseKind::Unknown;
+}
+
+#endif // EXERCISEKIND_H
@@ -38,8 +38,10 @@ ExerciseSequence::ExerciseSequence()
 {
 }
 
-ExerciseSequence::ExerciseSequence(const QList<Exercise*>& exercises)
+ExerciseSequence::ExerciseSequence(const QList<Exercise*>& exercises,
+                                   const QSharedPointer<ContentSnapshot>& content)
     : exerciseList(exercises)
+    , content(content)
 {
 }
 
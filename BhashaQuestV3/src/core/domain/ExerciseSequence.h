@@ -2,12 +2,17 @@
 #define EXERCISESEQUENCE_H
 
 #include <QList>
+#include <QSharedPointer>
 
 class Exercise;
+struct ContentSnapshot;
 
 /**
  * ExerciseSequence - Iterator-aware wrapper around an ordered set of exercises.
  * Centralizes traversal logic so clients can iterate without touching QList.
+ *
+ * A sequence built by ContentRepository keeps the content snapshot its exercises
+ * belong to alive, so content reloads never invalidate a running session.
  */
 class ExerciseSequence {
 public:
@@ -26,7 +31,8 @@ public:
     };
 
     ExerciseSequence();
-    explicit ExerciseSequence(const QList<Exercise*>& exercises);
+    explicit ExerciseSequence(const QList<Exercise*>& exercises,
+                              const QSharedPointer<ContentSnapshot>& content = QSharedPointer<ContentSnapshot>());
 
     bool isEmpty() const;
     int size() const;
@@ -37,6 +43,7 @@ public:
 
 private:
     QList<Exercise*> exerciseList;
+    QSharedPointer<ContentSnapshot> content;    // Owner of the exercises, held for our lifetime
 };
 
 #endif // EXERCISESEQUENCE_H
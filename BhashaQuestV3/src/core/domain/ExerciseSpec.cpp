@@ -0,0 +1,43 @@
+#include "ExerciseSpec.h"
+#include <QJsonArray>
+
+namespace {
+
+QStringList toStringList(const QJsonValue& value) {
+    QStringList list;
+    const QJsonArray array = value.toArray();
+    list.reserve(array.size());
+    for (const QJsonValue& item : array) {
+        list.append(item.toString());
+    }
+    return list;
+}
+
+} // namespace
+
+ExerciseSpec ExerciseSpec::fromJson(const QJsonObject& json) {
+    ExerciseSpec spec;
+
+    spec.type = json["type"].toString();
+    spec.id = json["id"].toString();
+    spec.prompt = json["prompt"].toString();
+    spec.skillId = json["skillId"].toString();
+    spec.audioFile = json["audioFile"].toString();
+    spec.difficulty = json["difficulty"].toInt(0);
+
+    // MCQ
+    spec.options = toStringList(json["options"]);
+    spec.correctIndex = json["correctIndex"].toInt(0);
+
+    // Translate
+    spec.englishPhrase = json["englishPhrase"].toString();
+    spec.correctAnswers = toStringList(json["correctAnswers"]);
+    spec.targetLanguage = json["targetLanguage"].toString();
+
+    // TileOrder
+    spec.tiles = toStringList(json["tiles"]);
+    spec.correctOrder = toStringList(json["correctOrder"]);
+    spec.shuffled = json["shuffled"].toBool(false);
+
+    return spec;
+}
@@ -0,0 +1,51 @@
+#ifndef EXERCISESPEC_H
+#define EXERCISESPEC_H
+
+#include <QString>
+#include <QStringList>
+#include <QJsonObject>
+
+/**
+ * ExerciseSpec - Plain description of one exercise, independent of its source
+ *
+ * Purpose: Decouples ExerciseFactory from the on-disk format.
+ * The JSON loader and the binary content pack both fill an ExerciseSpec,
+ * and ExerciseFactory builds the concrete Exercise from it.
+ *
+ * Fields that do not apply to a type are left empty.
+ * difficulty == 0 means "use the exercise type's default".
+ */
+struct ExerciseSpec {
+    // Common fields
+    QString type;                   // "MCQ", "Translate", "TileOrder"
+    QString id;
+    QString prompt;
+    QString skillId;
+    QString audioFile;
+    int difficulty;
+
+    // MCQ
+    QStringList options;
+    int correctIndex;
+
+    // Translate
+    QString englishPhrase;
+    QStringList correctAnswers;
+    QString targetLanguage;
+
+    // TileOrder
+    QStringList tiles;
+    QStringList correctOrder;
+    bool shuffled;
+
+    ExerciseSpec()
+        : difficulty(0), correctIndex(0), shuffled(false) {}
+
+    /**
+     * Build a spec from one exercise object of content.json
+     * @param json - Exercise object (must contain "type")
+     */
+    static ExerciseSpec fromJson(const QJsonObject& json);
+};
+
+#endif // EXERCISESPEC_H
@@ -0,0 +1,117 @@
+#include "FSRSEngine.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Power forgetting curve R(t) = (1 + kFactor * t / S)^kDecay, with R(S) = 0.9
+const double kDecay = -0.5;
+const double kFactor = 19.0 / 81.0;
+
+const double kMinimumStability = 0.01;
+const float kMinimumDifficulty = 1.0f;
+const float kMaximumDifficulty = 10.0f;
+
+// Published FSRS 4.5 defaults, then desired retention
+const double kDefaultParameters[FSRSEngine::kParameterCount] = {
+    0.4872, 1.4003, 3.7145, 13.8206, 5.1618, 1.2298, 0.8975, 0.031, 1.6474,
+    0.1367, 1.0461, 2.1072, 0.0793, 0.3246, 1.587, 0.2272, 2.8755,
+    0.9
+};
+
+float clampDifficulty(double difficulty) {
+    return static_cast<float>(std::min<double>(std::max<double>(difficulty, kMinimumDifficulty),
+                                               kMaximumDifficulty));
+}
+
+} // namespace
+
+FSRSEngine::FSRSEngine(const QVector<double>& parameters) {
+    const bool custom = parameters.size() == kParameterCount;
+    for (int i = 0; i < kWeightCount; ++i) {
+        w[i] = custom ? parameters[i] : kDefaultParameters[i];
+    }
+    desiredRetention = custom ? parameters[kWeightCount] : kDefaultParameters[kWeightCount];
+    desiredRetention = std::min(std::max(desiredRetention, 0.5), 0.99);
+
+    // Solve R(t) = desiredRetention for t: t = S * (r^(1 / decay) - 1) / factor
+    intervalFactor = (std::pow(desiredRetention, 1.0 / kDecay) - 1.0) / kFactor;
+}
+
+QVector<double> FSRSEngine::defaultParameters() {
+    return QVector<double>(kDefaultParameters, kDefaultParameters + kParameterCount);
+}
+
+QVector<double> FSRSEngine::parameters() const {
+    QVector<double> values(w, w + kWeightCount);
+    values.append(desiredRetention);
+    return values;
+}
+
+float FSRSEngine::defaultDifficulty() const {
+    // Initial difficulty of an item first graded Good
+    return clampDifficulty(w[4]);
+}
+
+int FSRSEngine::intervalFor(float stability) const {
+    const double days = std::round(stability * intervalFactor);
+    return static_cast<int>(std::min(std::max(days, 1.0), static_cast<double>(kMaximumInterval)));
+}
+
+// ========== Reviews ==========
+
+void FSRSEngine::review(MemoryStateTable& state, int row, ReviewGrade grade, qint32 today) const {
+    const int g = static_cast<int>(grade);
+    double stability = state.stability[row];
+    double difficulty = state.difficulty[row];
+
+    if (stability <= 0.0) {
+        stability = w[g - 1];
+        difficulty = clampDifficulty(w[4] - (g - 3) * w[5]);
+    } else {
+        const qint32 elapsed = std::max(0, today - state.lastReviewDay[row]);
+        const double recall = recallProbability(static_cast<float>(stability), elapsed);
+
+        if (grade == ReviewGrade::Again) {
+            const double relearned = w[11] * std::pow(difficulty, -w[12])
+                * (std::pow(stability + 1.0, w[13]) - 1.0) * std::exp(w[14] * (1.0 - recall));
+            stability = std::min(stability, relearned);
+        } else {
+            const double hardPenalty = grade == ReviewGrade::Hard ? w[15] : 1.0;
+            const double easyBonus = grade == ReviewGrade::Easy ? w[16] : 1.0;
+            stability *= 1.0 + std::exp(w[8]) * (11.0 - difficulty) * std::pow(stability, -w[9])
+                * (std::exp(w[10] * (1.0 - recall)) - 1.0) * hardPenalty * easyBonus;
+        }
+
+        // Difficulty moves with the grade, then reverts towards the Good starting value
+        const double moved = difficulty - w[6] * (g - 3);
+        difficulty = clampDifficulty(w[7] * w[4] + (1.0 - w[7]) * moved);
+    }
+
+    state.stability[row] = static_cast<float>(std::max(stability, kMinimumStability));
+    state.difficulty[row] = static_cast<float>(difficulty);
+    state.reviewCount[row] += 1;
+    state.lastReviewDay[row] = today;
+    state.dueDay[row] = today + intervalFor(state.stability[row]);
+}
+
+void FSRSEngine::reschedule(MemoryStateTable& state, int first, int count) const {
+    const float* stability = state.stability.constData() + first;
+    const qint32* lastReviewDay = state.lastReviewDay.constData() + first;
+    qint32* dueDay = state.dueDay.data() + first;
+    const float factor = static_cast<float>(intervalFactor);
+    const float maximum = static_cast<float>(kMaximumInterval);
+
+    for (int i = 0; i < count; ++i) {
+        const float days = std::min(std::max(stability[i] * factor, 1.0f), maximum);
+        dueDay[i] = lastReviewDay[i] + static_cast<qint32>(days + 0.5f);
+    }
+}
+
+double FSRSEngine::recallProbability(float stability, qint32 elapsedDays) const {
+    if (stability <= 0.0f) {
+        return 0.0;
+    }
+    // kDecay is -0.5: a square root is several times cheaper than pow()
+    return 1.0 / std::sqrt(1.0 + kFactor * std::max(0, elapsedDays) / stability);
+}
@@ -0,0 +1,51 @@
+#ifndef FSRSENGINE_H
+#define FSRSENGINE_H
+
+#include "SchedulingEngine.h"
+
+/**
+ * FSRSEngine - Free Spaced Repetition Scheduler (FSRS 4.5 memory model)
+ *
+ * DESIGN PATTERN: Strategy Pattern (Concrete Strategy)
+ * Each item has a stability S (days until recall probability falls to 90%)
+ * and a difficulty D in [1, 10]. Recall probability after t days follows the
+ * power forgetting curve R = (1 + F t / S)^-0.5 with F = 19/81. A review:
+ * - First review: S = w[grade - 1], D = w4 - (grade - 3) w5
+ * - Success: S grows by a factor that is larger for easy items, low S and
+ *   low R (reviewed late); Hard and Easy scale it by w15 / w16
+ * - Again: S drops to w11 D^-w12 ((S + 1)^w13 - 1) e^(w14 (1 - R))
+ * - D moves by -w6 (grade - 3) and reverts towards w4 by w7
+ * The next interval is the day R reaches the desired retention.
+ *
+ * Parameters: w0-w16, then the desired retention (default 0.9).
+ */
+class FSRSEngine : public SchedulingEngine {
+public:
+    static const int kWeightCount = 17;
+    static const int kParameterCount = kWeightCount + 1;
+
+    /**
+     * @param parameters - kParameterCount values, or empty for the published defaults
+     */
+    explicit FSRSEngine(const QVector<double>& parameters = QVector<double>());
+
+    QString name() const override { return "fsrs"; }
+    void review(MemoryStateTable& state, int row, ReviewGrade grade, qint32 today) const override;
+    void reschedule(MemoryStateTable& state, int first, int count) const override;
+    double recallProbability(float stability, qint32 elapsedDays) const override;
+    QVector<double> parameters() const override;
+
+    static QVector<double> defaultParameters();
+
+protected:
+    float defaultDifficulty() const override;
+
+private:
+    int intervalFor(float stability) const;
+
+    double w[kWeightCount];
+    double desiredRetention;
+    double intervalFactor;          // Interval in days per day of stability at desiredRetention
+};
+
+#endif // FSRSENGINE_H
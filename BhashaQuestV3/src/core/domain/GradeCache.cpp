@@ -0,0 +1,130 @@
+#include "GradeCache.h"
+#include <QMutexLocker>
+#include <QDebug>
+
+GradeCache::GradeCache(int capacity)
+    : entries(capacity)
+    , hits(0)
+    , misses(0)
+{
+}
+
+// ========== Lookup ==========
+
+GradeOutcome GradeCache::evaluate(const StrategyGrader* grader, const QString& userAnswer,
+                                  const Exercise* exercise) {
+    if (!grader) {
+        return GradeOutcome(GradeOutcome::InvalidExercise);
+    }
+    if (!exercise || exercise->getId().isEmpty()) {
+        return grader->evaluate(userAnswer, exercise);
+    }
+
+    const Key key{exercise, exercise->getId(), grader->canonicalAnswer(userAnswer)};
+    {
+        QMutexLocker locker(&mutex);
+        // object() also marks the entry most recently used
+        if (const GradeOutcome* cached = entries.object(key)) {
+            ++hits;
+            return *cached;
+        }
+        ++misses;
+    }
+
+    // Grade without holding the lock; a concurrent miss on the same key just
+    // stores the same outcome twice
+    const GradeOutcome outcome = grader->evaluate(userAnswer, exercise);
+
+    QMutexLocker locker(&mutex);
+    entries.insert(key, new GradeOutcome(outcome));
+    exerciseSkills.insert(key.exerciseId, exercise->getSkillId());
+    return outcome;
+}
+
+Result GradeCache::grade(const StrategyGrader* grader, const QString& userAnswer, const Exercise* exercise) {
+    const GradeOutcome outcome = evaluate(grader, userAnswer, exercise);
+    if (!grader) {
+        return Result(false, 0, "No grader for exercise");
+    }
+    return Result(outcome.isCorrect(), outcome.score, grader->feedback(outcome, exercise));
+}
+
+// ========== Invalidation ==========
+
+void GradeCache::invalidateExercise(const QString& exerciseId) {
+    QMutexLocker locker(&mutex);
+    // Keys hold the canonical answer too, so find every entry of the exercise
+    const QList<Key> keys = entries.keys();
+    for (const Key& key : keys) {
+        if (key.exerciseId == exerciseId) {
+            entries.remove(key);
+        }
+    }
+    exerciseSkills.remove(exerciseId);
+}
+
+void GradeCache::invalidateSkills(const QStringList& skillIds) {
+    if (skillIds.isEmpty()) {
+        return;
+    }
+
+    const QSet<QString> changed(skillIds.cbegin(), skillIds.cend());
+
+    QMutexLocker locker(&mutex);
+    const int before = entries.size();
+    // Decide from the side table: object() would reorder the LRU list
+    const QList<Key> keys = entries.keys();
+    for (const Key& key : keys) {
+        if (changed.contains(exerciseSkills.value(key.exerciseId))) {
+            entries.remove(key);
+        }
+    }
+    for (auto it = exerciseSkills.begin(); it != exerciseSkills.end();) {
+        if (changed.contains(it.value())) {
+            it = exerciseSkills.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    qDebug() << "GradeCache: Dropped" << before - entries.size() << "outcomes of"
+             << skillIds.size() << "changed skills";
+}
+
+void GradeCache::clear() {
+    QMutexLocker locker(&mutex);
+    entries.clear();
+    exerciseSkills.clear();
+}
+
+// ========== Capacity and Statistics ==========
+
+void GradeCache::setCapacity(int capacity) {
+    QMutexLocker locker(&mutex);
+    entries.setMaxCost(capacity);
+}
+
+int GradeCache::capacity() const {
+    QMutexLocker locker(&mutex);
+    return entries.maxCost();
+}
+
+int GradeCache::size() const {
+    QMutexLocker locker(&mutex);
+    return entries.size();
+}
+
+qint64 GradeCache::hitCount() const {
+    QMutexLocker locker(&mutex);
+    return hits;
+}
+
+qint64 GradeCache::missCount() const {
+    QMutexLocker locker(&mutex);
+    return misses;
+}
+
+void GradeCache::resetStatistics() {
+    QMutexLocker locker(&mutex);
+    hits = 0;
+    misses = 0;
+}
@@ -0,0 +1,95 @@
+#ifndef GRADECACHE_H
+#define GRADECACHE_H
+
+#include <QCache>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include "StrategyGrader.h"
+#include "Result.h"
+
+/**
+ * GradeCache - Bounded LRU memo of grading outcomes
+ *
+ * Purpose: Learners submit the same wrong answers over and over ("dhanybad",
+ * "namste"), and live checking grades the same text on every keystroke. The
+ * cache sits in front of a StrategyGrader and remembers the GradeOutcome of
+ * each (exercise, canonical answer) pair, so a repeat costs one hash probe.
+ * Feedback text is not stored; it is rebuilt from the outcome on each grade().
+ *
+ * Keys use StrategyGrader::canonicalAnswer(), so answers that differ only in
+ * ways the grader ignores (case, spacing, joiners for Translate) share an
+ * entry. An exercise is assumed to always be graded by the same grader, as
+ * GraderRegistry::graderFor() guarantees.
+ *
+ * Keys include the Exercise instance as well as its id. A session started
+ * before a reload keeps grading the previous snapshot's exercises; their
+ * outcomes land under those instances and are never served for the rebuilt
+ * ones. Unchanged skills share their instances across reloads, so their
+ * entries stay valid. Each exercise id's skill is kept on the side, so a
+ * content reload can drop exactly the entries of the skills it changed
+ * without disturbing the LRU order. Thread-safe; grading itself runs outside
+ * the lock.
+ *
+ * Usage: GradeCache cache(1024);
+ *        Result result = cache.grade(grader, answer, exercise);
+ */
+class GradeCache {
+public:
+    static const int kDefaultCapacity = 1024;
+
+    explicit GradeCache(int capacity = kDefaultCapacity);
+
+    /**
+     * Cached outcome, or grader->evaluate() on a miss
+     * Exercises without an id are graded but never cached.
+     */
+    GradeOutcome evaluate(const StrategyGrader* grader, const QString& userAnswer, const Exercise* exercise);
+
+    /**
+     * evaluate() plus the grader's feedback for the outcome
+     */
+    Result grade(const StrategyGrader* grader, const QString& userAnswer, const Exercise* exercise);
+
+    // Invalidation
+    void invalidateExercise(const QString& exerciseId);
+    void invalidateSkills(const QStringList& skillIds);
+    void clear();
+
+    /**
+     * Maximum number of entries; shrinking evicts least recently used ones
+     */
+    void setCapacity(int capacity);
+    int capacity() const;
+    int size() const;
+
+    // Counters since construction or resetStatistics()
+    qint64 hitCount() const;
+    qint64 missCount() const;
+    void resetStatistics();
+
+private:
+    struct Key {
+        const Exercise* exercise;   // Tells generations apart; never dereferenced
+        QString exerciseId;
+        QString answer;             // StrategyGrader::canonicalAnswer() form
+
+        bool operator==(const Key& other) const {
+            return exercise == other.exercise && exerciseId == other.exerciseId && answer == other.answer;
+        }
+    };
+
+    friend size_t qHash(const Key& key, size_t seed) {
+        return qHashMulti(seed, key.exercise, key.exerciseId, key.answer);
+    }
+
+    mutable QMutex mutex;
+    QCache<Key, GradeOutcome> entries;      // Cost 1 per entry, so maxCost is the capacity
+    QHash<QString, QString> exerciseSkills; // exercise id -> skill id, for invalidateSkills()
+    qint64 hits;
+    qint64 misses;
+};
+
+#endif // GRADECACHE_H
@@ -0,0 +1,94 @@
+#include "GraderRegistry.h"
+#include "TranslateExercise.h"
+#include <algorithm>
+
+GraderRegistry::GraderRegistry() {
+    gradersBySlot[static_cast<int>(ExerciseKind::Unknown)] = nullptr;
+    gradersBySlot[static_cast<int>(ExerciseKind::MCQ)] = &mcqGrader;
+    gradersBySlot[static_cast<int>(ExerciseKind::Translate)] = &translateGrader;
+    gradersBySlot[static_cast<int>(ExerciseKind::TileOrder)] = &tileOrderGrader;
+    gradersBySlot[kCharacterSelectionSlot] = &characterSelectionGrader;
+}
+
+GraderRegistry& GraderRegistry::getInstance() {
+    // Singleton Pattern: function-local static, created on first access
+    static GraderRegistry instance;
+    return instance;
+}
+
+const StrategyGrader* GraderRegistry::get(ExerciseKind kind) const {
+    const int index = static_cast<int>(kind);
+    if (index < 0 || index >= kKindCount) {
+        return nullptr;
+    }
+    return gradersBySlot[index];
+}
+
+const StrategyGrader* GraderRegistry::graderFor(const Exercise* exercise) const {
+    return gradersBySlot[slotFor(exercise)];
+}
+
+int GraderRegistry::slotFor(const Exercise* exercise) const {
+    if (!exercise) {
+        return static_cast<int>(ExerciseKind::Unknown);
+    }
+
+    const int kind = static_cast<int>(exercise->getKind());
+    if (kind < 0 || kind >= kKindCount) {
+        return static_cast<int>(ExerciseKind::Unknown);
+    }
+    if (exercise->getKind() == ExerciseKind::Translate
+        && static_cast<const TranslateExercise*>(exercise)->usesCharacterSelection()) {
+        return kCharacterSelectionSlot;
+    }
+    return kind;
+}
+
+// ========== Batch Grading ==========
+
+void GraderRegistry::gradeBatch(const GradeRequest* requests, int count, GradeOutcome* outcomes) const {
+    if (count <= 0) {
+        return;
+    }
+
+    // Counting sort of request indices by grader slot (stable, two passes)
+    QVector<quint8> slotOfRequest(count);
+    int slotStart[kSlotCount + 1] = {};
+    for (int i = 0; i < count; ++i) {
+        slotOfRequest[i] = static_cast<quint8>(slotFor(requests[i].exercise));
+        ++slotStart[slotOfRequest[i] + 1];
+    }
+    for (int slot = 0; slot < kSlotCount; ++slot) {
+        slotStart[slot + 1] += slotStart[slot];
+    }
+
+    QVector<int> order(count);
+    int fill[kSlotCount];
+    std::copy(slotStart, slotStart + kSlotCount, fill);
+    for (int i = 0; i < count; ++i) {
+        order[fill[slotOfRequest[i]]++] = i;
+    }
+
+    for (int slot = 0; slot < kSlotCount; ++slot) {
+        const int first = slotStart[slot];
+        const int runLength = slotStart[slot + 1] - first;
+        if (runLength == 0) {
+            continue;
+        }
+
+        const StrategyGrader* grader = gradersBySlot[slot];
+        if (!grader) {
+            for (int i = first; i < first + runLength; ++i) {
+                outcomes[order[i]] = GradeOutcome(GradeOutcome::InvalidExercise);
+            }
+            continue;
+        }
+        grader->gradeBatch(requests, order.constData() + first, runLength, outcomes);
+    }
+}
+
+QVector<GradeOutcome> GraderRegistry::gradeBatch(const QVector<GradeRequest>& requests) const {
+    QVector<GradeOutcome> outcomes(requests.size());
+    gradeBatch(requests.constData(), requests.size(), outcomes.data());
+    return outcomes;
+}
@@ -0,0 +1,84 @@
+#ifndef GRADERREGISTRY_H
+#define GRADERREGISTRY_H
+
+#include "ExerciseKind.h"
+#include "StrategyGrader.h"
+#include "MCQGrader.h"
+#include "TranslateGrader.h"
+#include "TileOrderGrader.h"
+#include "CharacterSelectionGrader.h"
+#include <QVector>
+
+/**
+ * GraderRegistry - Shared grading strategies, one per exercise kind
+ *
+ * DESIGN PATTERN: Singleton Pattern (Creational) holding Strategy Pattern instances
+ * Purpose: Graders keep no state between calls (every StrategyGrader method is
+ * const), so one instance of each can serve every exercise and every session.
+ * Callers borrow a pointer instead of allocating a grader per exercise.
+ *
+ * The graders are created with the registry and never change or get freed, so
+ * lookups need no locking and the returned pointers stay valid for the lifetime
+ * of the program. Thread-safe.
+ *
+ * Usage: const StrategyGrader* grader = GraderRegistry::getInstance().graderFor(exercise);
+ *        Result result = grader->grade(answer, exercise);
+ */
+class GraderRegistry {
+public:
+    /**
+     * Get the singleton instance
+     * @return Reference to the single GraderRegistry instance
+     */
+    static GraderRegistry& getInstance();
+
+    // Delete copy constructor and assignment operator (Singleton)
+    GraderRegistry(const GraderRegistry&) = delete;
+    GraderRegistry& operator=(const GraderRegistry&) = delete;
+
+    /**
+     * Default grader of an exercise kind
+     * @return nullptr for ExerciseKind::Unknown
+     */
+    const StrategyGrader* get(ExerciseKind kind) const;
+
+    /**
+     * Grader for a specific exercise: the kind's grader, except Translate
+     * exercises answered with the character picker, which are graded by
+     * CharacterSelectionGrader
+     * @return nullptr for null or unknown exercises
+     */
+    const StrategyGrader* graderFor(const Exercise* exercise) const;
+
+    /**
+     * Grade a mixed batch of answers without building feedback text
+     *
+     * Requests are grouped by grader so each grader evaluates one homogeneous
+     * run; outcomes[i] belongs to requests[i]. Requests without a grader
+     * (null or unknown exercises) get GradeOutcome::InvalidExercise.
+     * Feedback for any entry can be built later with
+     * graderFor(exercise)->feedback(outcome, exercise).
+     *
+     * @param outcomes - Array of at least count entries, filled in
+     */
+    void gradeBatch(const GradeRequest* requests, int count, GradeOutcome* outcomes) const;
+    QVector<GradeOutcome> gradeBatch(const QVector<GradeRequest>& requests) const;
+
+private:
+    GraderRegistry();
+
+    // Slot of the grader for a request: ExerciseKind value, or kCharacterSelectionSlot
+    int slotFor(const Exercise* exercise) const;
+
+    static const int kKindCount = 4;            // Including ExerciseKind::Unknown
+    static const int kCharacterSelectionSlot = kKindCount;
+    static const int kSlotCount = kKindCount + 1;
+
+    MCQGrader mcqGrader;
+    TranslateGrader translateGrader;
+    TileOrderGrader tileOrderGrader;
+    CharacterSelectionGrader characterSelectionGrader;
+    const StrategyGrader* gradersBySlot[kSlotCount];
+};
+
+#endif // GRADERREGISTRY_H
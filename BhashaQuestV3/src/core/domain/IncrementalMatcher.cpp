@@ -0,0 +1,136 @@
+#include "IncrementalMatcher.h"
+#include "AnswerNormalizer.h"
+#include <algorithm>
+#include <cstdlib>
+
+IncrementalMatcher::IncrementalMatcher(const AnswerTrie& answerTrie, int maxDistance)
+    : maxEdits(maxDistance)
+    , bandWidth(2 * maxDistance + 1)
+{
+    const Cell outOfReach = static_cast<Cell>(maxEdits + 1);
+
+    answers.reserve(answerTrie.size());
+    for (int index = 0; index < answerTrie.size(); ++index) {
+        AnswerState state;
+        state.text = answerTrie.answerAt(index);
+
+        // Row 0: D[0][j] = j (deleting the first j answer units)
+        state.rows.resize(bandWidth);
+        for (int t = 0; t < bandWidth; ++t) {
+            const int j = t - maxEdits;
+            state.rows[t] = (j < 0 || j > state.text.length())
+                ? outOfReach
+                : static_cast<Cell>(std::min(j, maxEdits + 1));
+        }
+        answers.append(state);
+    }
+}
+
+// ========== Updating ==========
+
+IncrementalMatcher::Match IncrementalMatcher::update(const QString& rawInput) {
+    const QString normalized = AnswerNormalizer::normalize(rawInput);
+
+    // Rows up to the common prefix are still valid; normalization can rewrite
+    // earlier units (case folding, composition), so this is not always "all but the last"
+    int common = 0;
+    const int limit = std::min(input.length(), normalized.length());
+    while (common < limit && input.at(common) == normalized.at(common)) {
+        ++common;
+    }
+
+    popRows(input.length() - common);
+    input.truncate(common);
+
+    const char16_t* units = reinterpret_cast<const char16_t*>(normalized.utf16());
+    for (int i = common; i < normalized.length(); ++i) {
+        input.append(normalized.at(i));
+        pushRow(units[i]);
+    }
+
+    return evaluate();
+}
+
+void IncrementalMatcher::pushRow(char16_t unit) {
+    // Row i = input.length(), derived from row i - 1 alone. Cell t of a row
+    // holds D[i][i - k + t], so D[i-1][j-1] sits at the same t in the previous
+    // row and D[i-1][j] one to the right.
+    const int i = input.length();
+    const int outOfReach = maxEdits + 1;
+
+    for (AnswerState& state : answers) {
+        const int answerLength = state.text.length();
+        const char16_t* text = reinterpret_cast<const char16_t*>(state.text.utf16());
+
+        const int previousStart = (i - 1) * bandWidth;
+        state.rows.resize(previousStart + 2 * bandWidth);
+        Cell* row = state.rows.data() + previousStart + bandWidth;
+        const Cell* previous = row - bandWidth;
+
+        for (int t = 0; t < bandWidth; ++t) {
+            const int j = i - maxEdits + t;
+            int value;
+            if (j < 0 || j > answerLength) {
+                value = outOfReach;
+            } else if (j == 0) {
+                value = std::min(i, outOfReach);
+            } else {
+                const int substitute = previous[t] + (text[j - 1] == unit ? 0 : 1);
+                const int insert = (t + 1 < bandWidth ? previous[t + 1] : outOfReach) + 1;
+                const int remove = (t > 0 ? row[t - 1] : outOfReach) + 1;
+                value = std::min({substitute, insert, remove, outOfReach});
+            }
+            row[t] = static_cast<Cell>(value);
+        }
+    }
+}
+
+void IncrementalMatcher::popRows(int count) {
+    if (count <= 0) {
+        return;
+    }
+    for (AnswerState& state : answers) {
+        state.rows.resize(state.rows.size() - count * bandWidth);
+    }
+}
+
+// ========== Evaluation ==========
+
+IncrementalMatcher::Match IncrementalMatcher::currentMatch() const {
+    return evaluate();
+}
+
+IncrementalMatcher::Match IncrementalMatcher::evaluate() const {
+    const int n = input.length();
+    if (n == 0) {
+        return NoMatch;
+    }
+
+    Match best = NoMatch;
+    for (const AnswerState& state : answers) {
+        const Cell* row = state.rows.constData() + n * bandWidth;
+        const int answerLength = state.text.length();
+
+        if (std::abs(n - answerLength) <= maxEdits) {
+            const int distance = row[answerLength - n + maxEdits];
+            if (distance == 0) {
+                return Exact;
+            }
+            if (distance <= maxEdits) {
+                best = Close;
+            }
+        }
+
+        if (best == NoMatch) {
+            // Some prefix answer[0..j) is within reach of the whole input
+            for (int t = 0; t < bandWidth; ++t) {
+                const int j = n - maxEdits + t;
+                if (j >= 0 && j <= answerLength && row[t] <= maxEdits) {
+                    best = OnTrack;
+                    break;
+                }
+            }
+        }
+    }
+    return best;
+}
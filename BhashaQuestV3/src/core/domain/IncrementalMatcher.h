@@ -0,0 +1,70 @@
+#ifndef INCREMENTALMATCHER_H
+#define INCREMENTALMATCHER_H
+
+#include <QString>
+#include <QVector>
+#include "AnswerTrie.h"
+
+/**
+ * IncrementalMatcher - Edit distance to every accepted answer, kept up to date while typing
+ *
+ * Purpose: The lesson view shows a live "on track / close / exact" hint under
+ * the Translate input. Regrading the whole text on every keystroke costs
+ * O(answers * length) each time; this matcher keeps, per accepted answer, one
+ * banded DP row per input character (the 2k + 1 cells with |i - j| <= k that
+ * can still be within k edits). Typing a character pushes one row, O(k) per
+ * answer; deleting pops rows. An edit in the middle (or a paste) pops back to
+ * the common prefix with the previous input and pushes from there.
+ *
+ * Input is compared in AnswerNormalizer form, the same as TranslateGrader, so
+ * Close and Exact agree with what grading the text would say. Answers the
+ * grader only accepts through the confusion-weighted ClusterDistance are not
+ * reported as Close.
+ *
+ * Not thread-safe: one matcher serves one input field. It keeps its own copy
+ * of the answers and may be updated from a worker thread.
+ */
+class IncrementalMatcher {
+public:
+    enum Match {
+        NoMatch,        // Not within maxDistance of any answer or answer prefix
+        OnTrack,        // Within maxDistance of the start of some answer
+        Close,          // Within maxDistance of a whole answer (graded correct)
+        Exact           // Equal to an answer after normalization
+    };
+
+    /**
+     * @param answerTrie - Accepted answers (TranslateExercise::getAnswerTrie())
+     * @param maxDistance - Typos tolerated, normally TranslateGrader::kMaxTypos
+     */
+    IncrementalMatcher(const AnswerTrie& answerTrie, int maxDistance);
+
+    /**
+     * Bring the DP state in line with the field's current text
+     * @param input - Raw text of the input field
+     */
+    Match update(const QString& input);
+
+    Match currentMatch() const;
+    int maxDistance() const { return maxEdits; }
+
+private:
+    // Distance cells are capped at maxEdits + 1 and fit a byte
+    using Cell = quint8;
+
+    void pushRow(char16_t unit);
+    void popRows(int count);
+    Match evaluate() const;
+
+    struct AnswerState {
+        QString text;
+        QVector<Cell> rows;     // Row i at [i * bandWidth, (i + 1) * bandWidth): D[i][i - k + t]
+    };
+
+    int maxEdits;
+    int bandWidth;              // 2 * maxEdits + 1
+    QString input;              // Normalized text the rows describe
+    QVector<AnswerState> answers;
+};
+
+#endif // INCREMENTALMATCHER_H
@@ -1,19 +1,18 @@
 #include "MCQGrader.h"
 
-Result MCQGrader::grade(const QString& userAnswer, const Exercise* exercise) {
-    // Cast to MCQExercise to access MCQ-specific methods
-    const MCQExercise* mcq = dynamic_cast<const MCQExercise*>(exercise);
-
-    if (!mcq) {
-        return Result(false, 0, "Error: Invalid exercise type for MCQGrader");
+GradeOutcome MCQGrader::evaluate(const QString& userAnswer, const Exercise* exercise) const {
+    // Check the type tag, then cast to MCQExercise to access MCQ-specific methods
+    if (!exercise || exercise->getKind() != ExerciseKind::MCQ) {
+        return GradeOutcome(GradeOutcome::InvalidExercise);
     }
+    const MCQExercise* mcq = static_cast<const MCQExercise*>(exercise);
 
     // Convert user answer to integer index
     bool ok;
     int userIndex = userAnswer.toInt(&ok);
 
     if (!ok) {
-        return Result(false, 0, "Error: Invalid answer format");
+        return GradeOutcome(GradeOutcome::InvalidAnswer);
     }
 
     // Check if answer is correct
@@ -21,10 +20,21 @@ Result MCQGrader::grade(const QString& userAnswer, const Exercise* exercise) {
     bool correct = (userIndex == correctIndex);
 
     if (correct) {
-        return Result(true, 10, QString("Correct! The answer is: %1")
-                      .arg(mcq->getCorrectAnswer()));
-    } else {
-        return Result(false, 0, QString("Incorrect. The correct answer is: %1")
-                      .arg(mcq->getCorrectAnswer()));
+        return GradeOutcome(GradeOutcome::Correct, 10);
+    }
+    return GradeOutcome(GradeOutcome::Incorrect);
+}
+
+QString MCQGrader::feedback(const GradeOutcome& outcome, const Exercise* exercise) const {
+    switch (outcome.status) {
+        case GradeOutcome::Correct:
+            return QString("Correct! The answer is: %1").arg(exercise->getCorrectAnswer());
+        case GradeOutcome::Incorrect:
+            return QString("Incorrect. The correct answer is: %1").arg(exercise->getCorrectAnswer());
+        case GradeOutcome::EmptyAnswer:
+        case GradeOutcome::InvalidAnswer:
+            return "Error: Invalid answer format";
+        default:
+            return "Error: Invalid exercise type for MCQGrader";
     }
 }
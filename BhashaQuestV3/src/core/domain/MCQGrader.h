@@ -16,9 +16,10 @@ public:
      * Grade MCQ answer
      * @param userAnswer - Index of selected option as string (e.g., "0", "1", "2", "3")
      * @param exercise - The MCQ exercise being graded
-     * @return Result with correct flag, score (10 if correct, 0 otherwise), and feedback
+     * @return Outcome with status and score (10 if correct, 0 otherwise); feedback() builds the message
      */
-    Result grade(const QString& userAnswer, const Exercise* exercise) override;
+    GradeOutcome evaluate(const QString& userAnswer, const Exercise* exercise) const override;
+    QString feedback(const GradeOutcome& outcome, const Exercise* exercise) const override;
 };
 
 #endif // MCQGRADER_H
@@ -2,9 +2,10 @@
 #include <QJsonArray>
 #include <QDebug>
 
-Profile::Profile(const QString& username)
+Profile::Profile(const QString& username, QSharedPointer<Clock> clock)
     : username(username), currentXP(0), streak(0), selectedLanguage("Nepali"),
-      lastActivityDate(QDate::currentDate()) {
+      clock(clock ? clock : QSharedPointer<Clock>::create()) {
+    lastActivityDate = this->clock->today();
 }
 
 Profile::~Profile() {
@@ -114,20 +115,22 @@ void Profile::fromJson(const QJsonObject& json) {
 
 // ========== Time Travel Methods ==========
 
-void Profile::advanceSimulatedDate(int days) {
-    if (!simulatedCurrentDate.isValid()) {
-        // Initialize to current real date
-        simulatedCurrentDate = QDate::currentDate();
+void Profile::setClock(QSharedPointer<Clock> newClock) {
+    if (newClock) {
+        clock = newClock;
     }
-    simulatedCurrentDate = simulatedCurrentDate.addDays(days);
-    qDebug() << "⏭️ Time Travel: Advanced to" << simulatedCurrentDate.toString(Qt::ISODate);
+}
+
+void Profile::advanceSimulatedDate(int days) {
+    clock->advance(days);
+    qDebug() << "⏭️ Time Travel: Advanced to" << clock->today().toString(Qt::ISODate);
 }
 
 QDate Profile::getCurrentDate() const {
-    return simulatedCurrentDate.isValid() ? simulatedCurrentDate : QDate::currentDate();
+    return clock->today();
 }
 
 void Profile::resetSimulatedDate() {
-    simulatedCurrentDate = QDate();  // Reset to invalid (use real date)
+    clock->reset();
     qDebug() << "🔄 Time Travel: Reset to real date";
 }
@@ -5,6 +5,8 @@
 #include <QMap>
 #include <QJsonObject>
 #include <QDate>
+#include <QSharedPointer>
+#include "Clock.h"
 #include "SkillProgress.h"
 
 /**
@@ -19,11 +21,14 @@ private:
     int streak;                             // Current streak in days
     QString selectedLanguage;
     QDate lastActivityDate;                 // Track for streak calculation
-    QDate simulatedCurrentDate;             // For testing time travel (if null, use real date)
+    QSharedPointer<Clock> clock;            // Real or simulated date, shared with SRSScheduler
     QMap<QString, SkillProgress*> skillProgress;  // skillId -> progress
 
 public:
-    Profile(const QString& username = "Player");
+    /**
+     * @param clock - Shared clock; a private one is created if null
+     */
+    Profile(const QString& username = "Player", QSharedPointer<Clock> clock = QSharedPointer<Clock>());
     ~Profile();
 
     // XP management
@@ -50,9 +55,13 @@ public:
     QDate getLastActivityDate() const { return lastActivityDate; }
     void setLastActivityDate(const QDate& date) { lastActivityDate = date; }
 
+    QSharedPointer<Clock> getClock() const { return clock; }
+    void setClock(QSharedPointer<Clock> newClock);
+
     // Time travel for testing
     /**
      * Advance simulated date by N days (for testing streak feature)
+     * Moves the shared clock, so review due dates follow.
      * @param days - Number of days to advance (default: 1)
      */
     void advanceSimulatedDate(int days = 1);
@@ -17,4 +17,29 @@ struct Result {
         : correct(correct), score(score), feedback(feedback) {}
 };
 
+/**
+ * GradeOutcome - Compact outcome of grading, without feedback text
+ *
+ * Two bytes per graded answer. Produced by StrategyGrader::evaluate() and
+ * the batch APIs; the feedback string of a Result is only built on demand
+ * with StrategyGrader::feedback().
+ */
+struct GradeOutcome {
+    enum Status : quint8 {
+        Correct = 0,
+        Incorrect,              // Well-formed answer that does not match
+        EmptyAnswer,            // Nothing entered / selected
+        InvalidAnswer,          // Answer not in the format the exercise expects
+        InvalidExercise         // Null exercise or one of the wrong kind
+    };
+
+    quint8 status;
+    quint8 score;               // Points earned (typically 0 or 10)
+
+    GradeOutcome(Status status = InvalidExercise, int score = 0)
+        : status(status), score(static_cast<quint8>(score)) {}
+
+    bool isCorrect() const { return status == Correct; }
+};
+
 #endif // RESULT_H
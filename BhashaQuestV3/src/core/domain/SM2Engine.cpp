@@ -0,0 +1,73 @@
+#include "SM2Engine.h"
+#include <algorithm>
+#include <cmath>
+
+SM2Engine::SM2Engine(const QVector<double>& parameters)
+    : initialEase(2.5f)
+    , minimumEase(1.3f)
+    , firstInterval(1.0f)
+    , secondInterval(6.0f)
+{
+    if (parameters.size() == kParameterCount) {
+        initialEase = static_cast<float>(parameters[0]);
+        minimumEase = static_cast<float>(parameters[1]);
+        firstInterval = static_cast<float>(parameters[2]);
+        secondInterval = static_cast<float>(parameters[3]);
+    }
+}
+
+// ========== Reviews ==========
+
+void SM2Engine::review(MemoryStateTable& state, int row, ReviewGrade grade, qint32 today) const {
+    float ease = state.stability[row] > 0.0f ? state.difficulty[row] : initialEase;
+    float interval = state.stability[row];
+    qint32& streak = state.reviewCount[row];
+
+    // Again/Hard/Good/Easy -> SM-2 quality 2/3/4/5
+    const int quality = static_cast<int>(grade) + 1;
+    const float miss = static_cast<float>(5 - quality);
+    ease = std::max(minimumEase, ease + 0.1f - miss * (0.08f + miss * 0.02f));
+
+    if (grade == ReviewGrade::Again) {
+        streak = 0;
+        interval = firstInterval;
+    } else {
+        if (streak == 0) {
+            interval = firstInterval;
+        } else if (streak == 1) {
+            interval = secondInterval;
+        } else {
+            interval = std::round(interval * ease);
+        }
+        ++streak;
+    }
+
+    interval = std::min(std::max(interval, 1.0f), static_cast<float>(kMaximumInterval));
+    state.stability[row] = interval;
+    state.difficulty[row] = ease;
+    state.lastReviewDay[row] = today;
+    state.dueDay[row] = today + static_cast<qint32>(interval);
+}
+
+void SM2Engine::reschedule(MemoryStateTable& state, int first, int count) const {
+    const float* stability = state.stability.constData() + first;
+    const qint32* lastReviewDay = state.lastReviewDay.constData() + first;
+    qint32* dueDay = state.dueDay.data() + first;
+
+    for (int i = 0; i < count; ++i) {
+        const float interval = std::min(std::max(stability[i], 1.0f), static_cast<float>(kMaximumInterval));
+        dueDay[i] = lastReviewDay[i] + static_cast<qint32>(interval + 0.5f);
+    }
+}
+
+double SM2Engine::recallProbability(float stability, qint32 elapsedDays) const {
+    // SM-2 has no forgetting curve; assume 90% recall at the scheduled interval
+    if (stability <= 0.0f) {
+        return 0.0;
+    }
+    return std::pow(0.9, std::max(0, elapsedDays) / static_cast<double>(stability));
+}
+
+QVector<double> SM2Engine::parameters() const {
+    return QVector<double>{initialEase, minimumEase, firstInterval, secondInterval};
+}
@@ -0,0 +1,44 @@
+#ifndef SM2ENGINE_H
+#define SM2ENGINE_H
+
+#include "SchedulingEngine.h"
+
+/**
+ * SM2Engine - SuperMemo 2 scheduling
+ *
+ * DESIGN PATTERN: Strategy Pattern (Concrete Strategy)
+ * Each item has an ease factor (difficulty column, starts at 2.5, never below
+ * 1.3) and a streak of successful reviews (reviewCount column):
+ * - Again resets the streak and brings the item back the next day
+ * - Otherwise the interval goes first -> second -> previous interval * ease
+ * - The ease moves with the grade: EF += 0.1 - (5 - q)(0.08 + (5 - q) 0.02),
+ *   with Again/Hard/Good/Easy as quality 2/3/4/5
+ *
+ * Parameters: initial ease, minimum ease, first interval, second interval.
+ */
+class SM2Engine : public SchedulingEngine {
+public:
+    static const int kParameterCount = 4;
+
+    /**
+     * @param parameters - kParameterCount values, or empty for the SM-2 defaults
+     */
+    explicit SM2Engine(const QVector<double>& parameters = QVector<double>());
+
+    QString name() const override { return "sm2"; }
+    void review(MemoryStateTable& state, int row, ReviewGrade grade, qint32 today) const override;
+    void reschedule(MemoryStateTable& state, int first, int count) const override;
+    double recallProbability(float stability, qint32 elapsedDays) const override;
+    QVector<double> parameters() const override;
+
+protected:
+    float defaultDifficulty() const override { return initialEase; }
+
+private:
+    float initialEase;
+    float minimumEase;
+    float firstInterval;
+    float secondInterval;
+};
+
+#endif // SM2ENGINE_H
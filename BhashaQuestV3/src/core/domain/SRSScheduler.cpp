@@ -1,91 +1,274 @@
 #include "SRSScheduler.h"
+#include <QDebug>
+#include <algorithm>
 
-SRSScheduler::SRSScheduler() {
+SRSScheduler::SRSScheduler(QSharedPointer<Clock> clock)
+    : clock(clock ? clock : QSharedPointer<Clock>::create())
+    , engine(SchedulingEngine::create("sm2")) {
 }
 
 void SRSScheduler::scheduleNextReview(const QString& exerciseId, Difficulty difficulty) {
-    ReviewData data;
+    scheduleNextReview(exerciseId, gradeFor(difficulty));
+}
 
-    // Check if exercise already has review data
-    if (reviewSchedule.contains(exerciseId)) {
-        data = reviewSchedule[exerciseId];
-    } else {
-        data.exerciseId = exerciseId;
-        data.lastReviewDate = QDate::currentDate();
+void SRSScheduler::scheduleNextReview(const QString& exerciseId, ReviewGrade grade) {
+    const qint32 today = dayFromDate(clock->today());
+
+    int item = findItem(exerciseId);
+    if (item < 0) {
+        item = addItem(exerciseId);
     }
 
-    // Calculate new interval based on difficulty
-    data.interval = calculateInterval(difficulty, data.interval);
-    data.difficulty = difficulty;
-    data.reviewCount++;
-    data.lastReviewDate = QDate::currentDate();
-    data.nextReviewDate = data.lastReviewDate.addDays(data.interval);
+    // Let the engine update the item's memory state and pick the next due day
+    engine->review(memory, item, grade, today);
 
-    // Update schedule
-    reviewSchedule[exerciseId] = data;
+    ReviewRecord& record = records[item];
+    record.lastReviewDay = today;
+    record.interval = memory.dueDay[item] - today;
+    record.difficulty = static_cast<quint8>(difficultyFor(grade));
+    record.reviewCount = static_cast<quint16>(std::min(record.reviewCount + 1, 0xFFFF));
+    setNextReviewDay(item, memory.dueDay[item]);
 }
 
 bool SRSScheduler::isDueForReview(const QString& exerciseId) const {
-    if (!reviewSchedule.contains(exerciseId)) {
+    const int item = findItem(exerciseId);
+    if (item < 0) {
         return false;
     }
-
-    const ReviewData& data = reviewSchedule[exerciseId];
-    return data.nextReviewDate <= QDate::currentDate();
+    return records[item].nextReviewDay <= dayFromDate(clock->today());
 }
 
 QList<QString> SRSScheduler::getReviewQueue() const {
     QList<QString> queue;
-    QDate today = QDate::currentDate();
+    const qint32 today = dayFromDate(clock->today());
 
-    for (auto it = reviewSchedule.begin(); it != reviewSchedule.end(); ++it) {
-        if (it.value().nextReviewDate <= today) {
-            queue.append(it.key());
+    // Only the days due by today; kNoDay sorts first and counts as due
+    const auto end = dueHeads.upperBound(today);
+    for (auto it = dueHeads.begin(); it != end; ++it) {
+        for (int item = it.value(); item >= 0; item = dueLinks[item].next) {
+            queue.append(itemIds[item]);
         }
     }
 
+    // Same order as before the index: by exercise id
+    std::sort(queue.begin(), queue.end());
     return queue;
 }
 
 ReviewData SRSScheduler::getReviewData(const QString& exerciseId) const {
-    if (reviewSchedule.contains(exerciseId)) {
-        return reviewSchedule[exerciseId];
+    const int item = findItem(exerciseId);
+    if (item >= 0) {
+        return toReviewData(item);
     }
     return ReviewData();
 }
 
 void SRSScheduler::setReviewData(const QString& exerciseId, const ReviewData& data) {
-    reviewSchedule[exerciseId] = data;
+    int item = findItem(exerciseId);
+    if (item < 0) {
+        item = addItem(exerciseId);
+    }
+
+    ReviewRecord& record = records[item];
+    record.lastReviewDay = dayFromDate(data.lastReviewDate);
+    record.interval = data.interval;
+    record.difficulty = static_cast<quint8>(data.difficulty);
+    record.reviewCount = static_cast<quint16>(std::min(std::max(data.reviewCount, 0), 0xFFFF));
+    setNextReviewDay(item, dayFromDate(data.nextReviewDate));
+
+    // Imported data has no engine state: start from the stored interval
+    if (data.lastReviewDate.isValid() && data.nextReviewDate.isValid()) {
+        engine->seed(memory, item, record.lastReviewDay, record.nextReviewDay);
+    }
 }
 
 void SRSScheduler::recordCompletion(const QString& exerciseId) {
-    if (!reviewSchedule.contains(exerciseId)) {
-        ReviewData data;
-        data.exerciseId = exerciseId;
-        data.lastReviewDate = QDate::currentDate();
-        data.nextReviewDate = data.lastReviewDate.addDays(1);
-        data.interval = 1;
-        data.reviewCount = 1;
-        reviewSchedule[exerciseId] = data;
+    if (findItem(exerciseId) < 0) {
+        const int item = addItem(exerciseId);
+        const qint32 today = dayFromDate(clock->today());
+
+        ReviewRecord& record = records[item];
+        record.lastReviewDay = today;
+        record.interval = 1;
+        record.reviewCount = 1;
+        setNextReviewDay(item, today + 1);
     }
 }
 
-int SRSScheduler::calculateInterval(Difficulty difficulty, int currentInterval) const {
-    // Simplified SRS algorithm for D2
-    switch (difficulty) {
-        case Difficulty::Easy:
-            // Easy: increase interval significantly (7 days or 2x current)
-            return std::max(7, currentInterval * 2);
+// ========== Clock ==========
 
-        case Difficulty::Medium:
-            // Medium: moderate increase (3 days or 1.5x current)
-            return std::max(3, static_cast<int>(currentInterval * 1.5));
+void SRSScheduler::setClock(QSharedPointer<Clock> newClock) {
+    if (newClock) {
+        clock = newClock;
+    }
+}
+
+QSharedPointer<Clock> SRSScheduler::getClock() const {
+    return clock;
+}
+
+// ========== Scheduling Engine ==========
+
+void SRSScheduler::setEngine(QSharedPointer<const SchedulingEngine> newEngine) {
+    if (!newEngine || newEngine == engine) {
+        return;
+    }
+    const bool sameModel = engine && engine->name() == newEngine->name();
+    engine = newEngine;
+    if (sameModel) {
+        return;     // Only parameters changed; the memory state still applies
+    }
+
+    // Stability and difficulty mean different things per engine: reseed
+    // every reviewed item from the interval it is on now
+    for (int row = 0; row < memory.size(); ++row) {
+        if (memory.stability[row] > 0.0f) {
+            engine->seed(memory, row, memory.lastReviewDay[row], memory.dueDay[row]);
+        }
+    }
+    qDebug() << "SRSScheduler: using" << engine->name() << "engine for" << memory.size() << "items";
+}
+
+QSharedPointer<const SchedulingEngine> SRSScheduler::getEngine() const {
+    return engine;
+}
+
+void SRSScheduler::rescheduleAll() {
+    engine->reschedule(memory, 0, memory.size());
+
+    for (int item = 0; item < records.size(); ++item) {
+        if (memory.stability[item] <= 0.0f) {
+            continue;   // Never reviewed: keep the day-after-completion date
+        }
+        records[item].interval = memory.dueDay[item] - memory.lastReviewDay[item];
+        if (records[item].nextReviewDay != memory.dueDay[item]) {
+            setNextReviewDay(item, memory.dueDay[item]);
+        }
+    }
+}
+
+bool SRSScheduler::loadEngineParameters(const QString& filePath, QString* errorMessage) {
+    auto loaded = SchedulingEngine::load(filePath, errorMessage);
+    if (!loaded) {
+        return false;
+    }
+
+    setEngine(loaded);
+    rescheduleAll();
+    qDebug() << "SRSScheduler: loaded" << loaded->name() << "parameters from" << filePath;
+    return true;
+}
 
+ReviewGrade SRSScheduler::gradeFor(Difficulty difficulty) {
+    // The three-point rating has no Again: Hard is the weakest grade
+    switch (difficulty) {
         case Difficulty::Hard:
-            // Hard: minimal increase (1 day or keep same)
-            return std::max(1, currentInterval);
+            return ReviewGrade::Hard;
+        case Difficulty::Easy:
+            return ReviewGrade::Easy;
+        case Difficulty::Medium:
+        default:
+            return ReviewGrade::Good;
+    }
+}
 
+Difficulty SRSScheduler::difficultyFor(ReviewGrade grade) {
+    switch (grade) {
+        case ReviewGrade::Again:
+        case ReviewGrade::Hard:
+            return Difficulty::Hard;
+        case ReviewGrade::Easy:
+            return Difficulty::Easy;
+        case ReviewGrade::Good:
         default:
-            return 1;
+            return Difficulty::Medium;
     }
 }
+
+// ========== Item Storage ==========
+
+int SRSScheduler::findItem(const QString& exerciseId) const {
+    auto existing = itemIndex.constFind(exerciseId);
+    return existing != itemIndex.constEnd() ? existing.value() : -1;
+}
+
+int SRSScheduler::addItem(const QString& exerciseId) {
+    const int item = itemIds.size();
+    auto inserted = itemIndex.insert(exerciseId, item);
+    itemIds.append(inserted.key());
+
+    ReviewRecord record;
+    record.lastReviewDay = kNoDay;
+    record.nextReviewDay = kNoDay;
+    record.interval = 1;
+    record.reviewCount = 0;
+    record.difficulty = static_cast<quint8>(Difficulty::Medium);
+    record.reserved = 0;
+    records.append(record);
+
+    dueLinks.append(DueLink{-1, -1});
+    memory.append();
+    linkDue(item);
+    return item;
+}
+
+void SRSScheduler::setNextReviewDay(int item, qint32 day) {
+    if (records[item].nextReviewDay == day) {
+        return;
+    }
+    unlinkDue(item);
+    records[item].nextReviewDay = day;
+    linkDue(item);
+}
+
+void SRSScheduler::linkDue(int item) {
+    // Push onto the front of the day's list
+    auto head = dueHeads.find(records[item].nextReviewDay);
+    if (head == dueHeads.end()) {
+        dueHeads.insert(records[item].nextReviewDay, item);
+        dueLinks[item] = DueLink{-1, -1};
+        return;
+    }
+    dueLinks[item] = DueLink{-1, head.value()};
+    dueLinks[head.value()].previous = item;
+    head.value() = item;
+}
+
+void SRSScheduler::unlinkDue(int item) {
+    const DueLink link = dueLinks[item];
+    if (link.previous >= 0) {
+        dueLinks[link.previous].next = link.next;
+    } else {
+        // First of its day: the list now starts at the next item, or the day goes
+        auto head = dueHeads.find(records[item].nextReviewDay);
+        if (link.next >= 0) {
+            head.value() = link.next;
+        } else {
+            dueHeads.erase(head);
+        }
+    }
+    if (link.next >= 0) {
+        dueLinks[link.next].previous = link.previous;
+    }
+    dueLinks[item] = DueLink{-1, -1};
+}
+
+ReviewData SRSScheduler::toReviewData(int item) const {
+    const ReviewRecord& record = records[item];
+    ReviewData data;
+    data.exerciseId = itemIds[item];
+    data.lastReviewDate = dateFromDay(record.lastReviewDay);
+    data.nextReviewDate = dateFromDay(record.nextReviewDay);
+    data.interval = record.interval;
+    data.difficulty = static_cast<Difficulty>(record.difficulty);
+    data.reviewCount = record.reviewCount;
+    return data;
+}
+
+qint32 SRSScheduler::dayFromDate(const QDate& date) {
+    return date.isValid() ? static_cast<qint32>(date.toJulianDay()) : kNoDay;
+}
+
+QDate SRSScheduler::dateFromDay(qint32 day) {
+    return day != kNoDay ? QDate::fromJulianDay(day) : QDate();
+}
@@ -4,17 +4,34 @@
 #include <QString>
 #include <QDate>
 #include <QMap>
+#include <QHash>
 #include <QList>
+#include <QVector>
+#include <QSharedPointer>
+#include <limits>
+#include "SchedulingEngine.h"
+#include "Clock.h"
 
 /**
  * SRSScheduler - Spaced Repetition System scheduler
  *
- * Implements simplified spaced repetition algorithm for D2:
- * - Easy difficulty: +7 days
- * - Medium difficulty: +3 days
- * - Hard difficulty: +1 day
+ * The memory model is a pluggable SchedulingEngine (SM-2 by default, FSRS via
+ * setEngine()). The user's Hard/Medium/Easy rating is passed to it as the
+ * Hard/Good/Easy review grade, and the engine decides the next due day.
  *
- * Future (D3): Implement full SM-2 algorithm with ease factor
+ * "Today" comes from a Clock shared with Profile, so time travel moves the
+ * review queue along with the streak.
+ *
+ * Storage: exercise ids are interned once into dense item numbers. An item's
+ * schedule is a 16-byte ReviewRecord (days as int32 Julian day numbers) in one
+ * packed array, and its engine state is the same row of a MemoryStateTable,
+ * so rescheduleAll() and other full scans walk contiguous memory. ReviewData
+ * is only built when a caller asks for it.
+ *
+ * A due-date index chains items due on the same day into a list threaded
+ * through a per-item link array. getReviewQueue() only visits the days up to
+ * today, so it costs O(due items) however many items were ever reviewed;
+ * rescheduling unlinks an item in O(1) and relinks it in O(log days).
  */
 
 enum class Difficulty {
@@ -37,10 +54,42 @@ struct ReviewData {
 
 class SRSScheduler {
 private:
-    QMap<QString, ReviewData> reviewSchedule;  // exerciseId -> ReviewData
+    /**
+     * ReviewRecord - Packed schedule of one item (ReviewData without the id)
+     */
+    struct ReviewRecord {
+        qint32 lastReviewDay;       // Julian day, kNoDay if unset
+        qint32 nextReviewDay;       // Julian day, kNoDay if unset (counts as due)
+        qint32 interval;
+        quint16 reviewCount;        // Saturates at 65535
+        quint8 difficulty;          // Difficulty value
+        quint8 reserved;
+    };
+    static_assert(sizeof(ReviewRecord) == 16, "ReviewRecord should stay packed");
+
+    // Neighbours in the list of items due on the same day, -1 at either end
+    struct DueLink {
+        qint32 previous;
+        qint32 next;
+    };
+
+    static constexpr qint32 kNoDay = std::numeric_limits<qint32>::min();
+
+    QHash<QString, int> itemIndex;             // exerciseId -> item
+    QVector<QString> itemIds;                  // item -> exerciseId (shares the hash key's data)
+    QVector<ReviewRecord> records;             // item -> schedule
+    QVector<DueLink> dueLinks;                 // item -> due-day list links
+    QMap<qint32, int> dueHeads;                // nextReviewDay -> first item due that day
+
+    QSharedPointer<Clock> clock;
+    QSharedPointer<const SchedulingEngine> engine;
+    MemoryStateTable memory;                   // Engine state, row = item
 
 public:
-    SRSScheduler();
+    /**
+     * @param clock - Shared clock; a private one following the real date is created if null
+     */
+    explicit SRSScheduler(QSharedPointer<Clock> clock = QSharedPointer<Clock>());
 
     /**
      * Schedule next review for an exercise based on user-rated difficulty
@@ -49,6 +98,12 @@ public:
      */
     void scheduleNextReview(const QString& exerciseId, Difficulty difficulty);
 
+    /**
+     * Schedule next review from a four-point grade
+     * Unlike the Hard/Medium/Easy rating this can record a lapse (Again).
+     */
+    void scheduleNextReview(const QString& exerciseId, ReviewGrade grade);
+
     /**
      * Check if an exercise is due for review
      * @param exerciseId - ID of the exercise
@@ -77,11 +132,62 @@ public:
      */
     void recordCompletion(const QString& exerciseId);
 
+    /**
+     * Switch the memory model
+     * Items already scheduled keep their due dates. An engine of another kind
+     * starts them from their current interval; the same kind with new
+     * parameters keeps their memory state.
+     */
+    void setEngine(QSharedPointer<const SchedulingEngine> newEngine);
+
+    QSharedPointer<const SchedulingEngine> getEngine() const;
+
+    /**
+     * Share the date source with Profile (time travel)
+     */
+    void setClock(QSharedPointer<Clock> newClock);
+    QSharedPointer<Clock> getClock() const;
+
+    /**
+     * Recompute every due date from the engine's memory state
+     * Call after loading new engine parameters.
+     */
+    void rescheduleAll();
+
+    /**
+     * Use the engine and parameters from an optimizer output file, then rescheduleAll()
+     * @return false (and errorMessage) if the file cannot be read; the engine is unchanged
+     */
+    bool loadEngineParameters(const QString& filePath, QString* errorMessage = nullptr);
+
 private:
     /**
-     * Calculate next review interval based on difficulty
+     * Item number of an exercise, or -1 if it has no review data
+     */
+    int findItem(const QString& exerciseId) const;
+
+    /**
+     * Intern a new exercise: adds its record, links and memory row
+     * The record starts unscheduled (due at once) until setNextReviewDay().
+     */
+    int addItem(const QString& exerciseId);
+
+    /**
+     * Change an item's due day and move it to that day's list
+     * Every due-day change goes through here to keep dueHeads in step.
      */
-    int calculateInterval(Difficulty difficulty, int currentInterval) const;
+    void setNextReviewDay(int item, qint32 day);
+
+    void linkDue(int item);
+    void unlinkDue(int item);
+
+    ReviewData toReviewData(int item) const;
+
+    static qint32 dayFromDate(const QDate& date);
+    static QDate dateFromDay(qint32 day);
+
+    static ReviewGrade gradeFor(Difficulty difficulty);
+    static Difficulty difficultyFor(ReviewGrade grade);
 };
 
 #endif // SRSSCHEDULER_H
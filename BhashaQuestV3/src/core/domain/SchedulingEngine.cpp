@@ -0,0 +1,137 @@
+#include "SchedulingEngine.h"
+#include "SM2Engine.h"
+#include "FSRSEngine.h"
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+namespace {
+
+void setError(QString* errorMessage, const QString& message) {
+    if (errorMessage) {
+        *errorMessage = message;
+    }
+}
+
+} // namespace
+
+// ========== MemoryStateTable ==========
+
+int MemoryStateTable::append() {
+    stability.append(0.0f);
+    difficulty.append(0.0f);
+    lastReviewDay.append(0);
+    dueDay.append(0);
+    reviewCount.append(0);
+    return stability.size() - 1;
+}
+
+void MemoryStateTable::reserve(int rows) {
+    stability.reserve(rows);
+    difficulty.reserve(rows);
+    lastReviewDay.reserve(rows);
+    dueDay.reserve(rows);
+    reviewCount.reserve(rows);
+}
+
+// ========== SchedulingEngine ==========
+
+void SchedulingEngine::reviewBatch(MemoryStateTable& state, const int* rows, const ReviewGrade* grades,
+                                   int count, qint32 today) const {
+    for (int i = 0; i < count; ++i) {
+        review(state, rows[i], grades[i], today);
+    }
+}
+
+void SchedulingEngine::seed(MemoryStateTable& state, int row, qint32 lastReviewDay, qint32 dueDay) const {
+    // Treat the current interval as what the item's memory can carry
+    state.stability[row] = static_cast<float>(qMax(1, dueDay - lastReviewDay));
+    state.difficulty[row] = defaultDifficulty();
+    state.lastReviewDay[row] = lastReviewDay;
+    state.dueDay[row] = dueDay;
+    state.reviewCount[row] = 1;
+}
+
+QSharedPointer<const SchedulingEngine> SchedulingEngine::create(const QString& name,
+                                                                const QVector<double>& parameters,
+                                                                QString* errorMessage) {
+    int expected = 0;
+    if (name == "sm2") {
+        expected = SM2Engine::kParameterCount;
+    } else if (name == "fsrs") {
+        expected = FSRSEngine::kParameterCount;
+    } else {
+        setError(errorMessage, QString("Unknown scheduling engine: %1 (available: %2)")
+                 .arg(name, availableEngines().join(", ")));
+        return QSharedPointer<const SchedulingEngine>();
+    }
+
+    if (!parameters.isEmpty() && parameters.size() != expected) {
+        setError(errorMessage, QString("Engine %1 takes %2 parameters, got %3")
+                 .arg(name).arg(expected).arg(parameters.size()));
+        return QSharedPointer<const SchedulingEngine>();
+    }
+
+    if (name == "sm2") {
+        return QSharedPointer<const SchedulingEngine>(new SM2Engine(parameters));
+    }
+    return QSharedPointer<const SchedulingEngine>(new FSRSEngine(parameters));
+}
+
+QStringList SchedulingEngine::availableEngines() {
+    return QStringList{"sm2", "fsrs"};
+}
+
+// ========== Parameter Files ==========
+
+QJsonObject SchedulingEngine::toJson() const {
+    QJsonArray values;
+    for (double value : parameters()) {
+        values.append(value);
+    }
+
+    QJsonObject json;
+    json["engine"] = name();
+    json["parameters"] = values;
+    return json;
+}
+
+QSharedPointer<const SchedulingEngine> SchedulingEngine::fromJson(const QJsonObject& json,
+                                                                  QString* errorMessage) {
+    if (!json["engine"].isString() || !json["parameters"].isArray()) {
+        setError(errorMessage, "Expected \"engine\" and \"parameters\"");
+        return QSharedPointer<const SchedulingEngine>();
+    }
+
+    QVector<double> parameters;
+    for (const QJsonValue& value : json["parameters"].toArray()) {
+        if (!value.isDouble()) {
+            setError(errorMessage, "Parameters must be numbers");
+            return QSharedPointer<const SchedulingEngine>();
+        }
+        parameters.append(value.toDouble());
+    }
+    return create(json["engine"].toString(), parameters, errorMessage);
+}
+
+QSharedPointer<const SchedulingEngine> SchedulingEngine::load(const QString& filePath, QString* errorMessage) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        setError(errorMessage, QString("Cannot open %1").arg(filePath));
+        return QSharedPointer<const SchedulingEngine>();
+    }
+
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+        setError(errorMessage, QString("Invalid JSON in %1: %2").arg(filePath, parseError.errorString()));
+        return QSharedPointer<const SchedulingEngine>();
+    }
+
+    QString error;
+    auto engine = fromJson(document.object(), &error);
+    if (!engine) {
+        setError(errorMessage, QString("%1: %2").arg(filePath, error));
+    }
+    return engine;
+}
@@ -0,0 +1,141 @@
+#ifndef SCHEDULINGENGINE_H
+#define SCHEDULINGENGINE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QSharedPointer>
+#include <QJsonObject>
+
+/**
+ * ReviewGrade - How well a review went, on the four-point scale both
+ * SM-2 (mapped to quality 2-5) and FSRS use
+ */
+enum class ReviewGrade : quint8 {
+    Again = 1,      // Forgotten
+    Hard = 2,
+    Good = 3,
+    Easy = 4
+};
+
+/**
+ * MemoryStateTable - Scheduling state of many items as parallel columns
+ *
+ * Row r of every column belongs to the same item. Columns are contiguous
+ * floats and ints, so a pass over one field (rescheduling after new
+ * parameters, simulations) streams through memory and vectorizes.
+ * Days are Julian day numbers.
+ */
+struct MemoryStateTable {
+    QVector<float> stability;       // Memory strength in days (SM-2: current interval); <= 0 for new items
+    QVector<float> difficulty;      // FSRS difficulty 1-10; SM-2 ease factor
+    QVector<qint32> lastReviewDay;
+    QVector<qint32> dueDay;
+    QVector<qint32> reviewCount;    // Engine's repetition counter (SM-2: successful streak)
+
+    int size() const { return stability.size(); }
+
+    /**
+     * Add a new, never reviewed item
+     * @return Its row
+     */
+    int append();
+
+    void reserve(int rows);
+};
+
+/**
+ * SchedulingEngine - Memory model that turns review grades into due days
+ *
+ * DESIGN PATTERN: Strategy Pattern (Behavioral) with a Factory method
+ * Purpose: SRSScheduler delegates "when is this due next" to a pluggable
+ * engine, so the memory model (SM-2, FSRS) can be swapped or re-tuned
+ * without touching how reviews are stored or queued.
+ *
+ * Engines keep no per-item state of their own: everything lives in the
+ * caller's MemoryStateTable, and every method is const. One engine instance
+ * can serve any number of schedulers and threads.
+ *
+ * Usage: QSharedPointer<const SchedulingEngine> engine = SchedulingEngine::create("fsrs");
+ *        engine->review(table, row, ReviewGrade::Good, today);
+ */
+class SchedulingEngine {
+public:
+    static const int kMaximumInterval = 36500;     // Days
+
+    virtual ~SchedulingEngine() = default;
+
+    virtual QString name() const = 0;
+
+    /**
+     * Apply one review of item row, graded on day today
+     * Updates stability, difficulty and the counter, sets lastReviewDay to today
+     * and dueDay to the next review.
+     */
+    virtual void review(MemoryStateTable& state, int row, ReviewGrade grade, qint32 today) const = 0;
+
+    /**
+     * review() for many items reviewed the same day
+     * @param rows - Rows to update; grades[i] belongs to rows[i]
+     */
+    virtual void reviewBatch(MemoryStateTable& state, const int* rows, const ReviewGrade* grades,
+                             int count, qint32 today) const;
+
+    /**
+     * Recompute dueDay of rows [first, first + count) from stability and
+     * lastReviewDay, e.g. after loading new parameters. One branch-free pass.
+     */
+    virtual void reschedule(MemoryStateTable& state, int first, int count) const = 0;
+
+    /**
+     * Give an item this engine has never seen a state matching its current interval
+     * Used when review data is imported or the engine is switched.
+     */
+    virtual void seed(MemoryStateTable& state, int row, qint32 lastReviewDay, qint32 dueDay) const;
+
+    /**
+     * Probability that an item with this stability is recalled after elapsedDays
+     */
+    virtual double recallProbability(float stability, qint32 elapsedDays) const = 0;
+
+    /**
+     * Tunable parameters, in the order the constructor and the optimizer use
+     */
+    virtual QVector<double> parameters() const = 0;
+
+    /**
+     * Create an engine by name ("sm2", "fsrs")
+     * @param parameters - Empty for the defaults
+     * @return nullptr (and errorMessage) for unknown names or a wrong parameter count
+     */
+    static QSharedPointer<const SchedulingEngine> create(const QString& name,
+                                                         const QVector<double>& parameters = QVector<double>(),
+                                                         QString* errorMessage = nullptr);
+
+    static QStringList availableEngines();
+
+    /**
+     * Engine name and parameters as {"engine": ..., "parameters": [...]}
+     * This is the format the optimizer writes and load() reads.
+     */
+    QJsonObject toJson() const;
+
+    /**
+     * Create an engine from toJson() output; other keys are ignored
+     */
+    static QSharedPointer<const SchedulingEngine> fromJson(const QJsonObject& json,
+                                                           QString* errorMessage = nullptr);
+
+    /**
+     * Read a parameter file written by the optimizer
+     * @return nullptr (and errorMessage) if the file is missing or invalid
+     */
+    static QSharedPointer<const SchedulingEngine> load(const QString& filePath,
+                                                       QString* errorMessage = nullptr);
+
+protected:
+    // Difficulty given to seeded items
+    virtual float defaultDifficulty() const = 0;
+};
+
+#endif // SCHEDULINGENGINE_H
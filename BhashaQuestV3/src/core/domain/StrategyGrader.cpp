@@ -1,4 +1,18 @@
 #include "StrategyGrader.h"
 
-// StrategyGrader is an abstract interface with only pure virtual methods
-// No implementation needed - all methods are defined in derived classes
+Result StrategyGrader::grade(const QString& userAnswer, const Exercise* exercise) const {
+    const GradeOutcome outcome = evaluate(userAnswer, exercise);
+    return Result(outcome.isCorrect(), outcome.score, feedback(outcome, exercise));
+}
+
+void StrategyGrader::gradeBatch(const GradeRequest* requests, const int* indices, int count,
+                                GradeOutcome* outcomes) const {
+    for (int i = 0; i < count; ++i) {
+        const GradeRequest& request = requests[indices[i]];
+        outcomes[indices[i]] = evaluate(request.answer, request.exercise);
+    }
+}
+
+QString StrategyGrader::canonicalAnswer(const QString& userAnswer) const {
+    return userAnswer;
+}
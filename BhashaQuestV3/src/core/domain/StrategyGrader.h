@@ -5,6 +5,14 @@
 #include "Exercise.h"
 #include <QString>
 
+/**
+ * GradeRequest - One (exercise, answer) pair to grade in a batch
+ */
+struct GradeRequest {
+    const Exercise* exercise;
+    QString answer;             // In the format LessonView submits for the kind
+};
+
 /**
  * StrategyGrader - Abstract interface for the Strategy Pattern
  *
@@ -14,6 +22,11 @@
  * - TranslateGrader: Fuzzy string matching with multiple valid answers
  * - TileOrderGrader: Sequence order matching
  *
+ * Grading is split in two: evaluate() decides correctness and score into a
+ * compact GradeOutcome, feedback() turns an outcome into the message shown to
+ * the learner. grade() does both; bulk callers (exports, re-scoring) use
+ * gradeBatch() and only ask for feedback where they need it.
+ *
  * DESIGN PATTERN: Strategy Pattern (Behavioral)
  * Purpose: Allows pluggable grading algorithms per exercise type
  */
@@ -27,7 +40,32 @@ public:
      * @param exercise - The exercise being graded
      * @return Result struct with correct flag, score, and feedback
      */
-    virtual Result grade(const QString& userAnswer, const Exercise* exercise) = 0;
+    Result grade(const QString& userAnswer, const Exercise* exercise) const;
+
+    /**
+     * Decide correctness and score without building any feedback text
+     */
+    virtual GradeOutcome evaluate(const QString& userAnswer, const Exercise* exercise) const = 0;
+
+    /**
+     * Feedback message for an outcome produced by this grader for exercise
+     */
+    virtual QString feedback(const GradeOutcome& outcome, const Exercise* exercise) const = 0;
+
+    /**
+     * Evaluate requests[indices[0..count)] into outcomes[indices[i]]
+     * All selected requests are expected to belong to this grader
+     * (see GraderRegistry::gradeBatch() for mixed batches).
+     */
+    virtual void gradeBatch(const GradeRequest* requests, const int* indices, int count,
+                            GradeOutcome* outcomes) const;
+
+    /**
+     * Form of an answer that decides its outcome
+     * Two answers with the same canonical form must get the same outcome for
+     * any exercise; GradeCache keys on it. The default is the answer itself.
+     */
+    virtual QString canonicalAnswer(const QString& userAnswer) const;
 };
 
 #endif // STRATEGYGRADER_H
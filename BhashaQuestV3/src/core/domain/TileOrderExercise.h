@@ -24,7 +24,6 @@ public:
     QString getPrompt() const override;
     QString getCorrectAnswer() const override;
     QString getType() const override;
-    QWidget* renderUI(QWidget* parent = nullptr) override;
 
     // TileOrder-specific methods
     QStringList getTiles() const { return tiles; }
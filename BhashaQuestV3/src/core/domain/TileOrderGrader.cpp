@@ -1,18 +1,17 @@
 #include "TileOrderGrader.h"
 #include <QDebug>
 
-Result TileOrderGrader::grade(const QString& userAnswer, const Exercise* exercise) {
-    // Cast to TileOrderExercise to access TileOrder-specific methods
-    const TileOrderExercise* tileEx = dynamic_cast<const TileOrderExercise*>(exercise);
-
-    if (!tileEx) {
-        return Result(false, 0, "Error: Invalid exercise type for TileOrderGrader");
+GradeOutcome TileOrderGrader::evaluate(const QString& userAnswer, const Exercise* exercise) const {
+    // Check the type tag, then cast to TileOrderExercise to access TileOrder-specific methods
+    if (!exercise || exercise->getKind() != ExerciseKind::TileOrder) {
+        return GradeOutcome(GradeOutcome::InvalidExercise);
     }
+    const TileOrderExercise* tileEx = static_cast<const TileOrderExercise*>(exercise);
 
     QString trimmedAnswer = userAnswer.trimmed();
 
     if (trimmedAnswer.isEmpty()) {
-        return Result(false, 0, "Please arrange the tiles to form your answer");
+        return GradeOutcome(GradeOutcome::EmptyAnswer);
     }
 
     // Convert user answer from semicolon-separated to space-separated
@@ -26,11 +25,25 @@ Result TileOrderGrader::grade(const QString& userAnswer, const Exercise* exercis
     bool correct = (userOrderSpaced == correctAnswer);
 
     if (correct) {
-        return Result(true, 10, "Perfect! You arranged the words correctly!");
-    } else {
-        // Provide helpful feedback showing the correct order
-        QStringList correctTiles = correctAnswer.split(" ");
-        QString formattedCorrect = correctTiles.join(" → ");
-        return Result(false, 0, QString("Not quite right. Correct order: %1").arg(formattedCorrect));
+        return GradeOutcome(GradeOutcome::Correct, 10);
+    }
+    return GradeOutcome(GradeOutcome::Incorrect);
+}
+
+QString TileOrderGrader::feedback(const GradeOutcome& outcome, const Exercise* exercise) const {
+    switch (outcome.status) {
+        case GradeOutcome::Correct:
+            return "Perfect! You arranged the words correctly!";
+        case GradeOutcome::Incorrect: {
+            // Provide helpful feedback showing the correct order
+            QStringList correctTiles = exercise->getCorrectAnswer().split(" ");
+            QString formattedCorrect = correctTiles.join(" → ");
+            return QString("Not quite right. Correct order: %1").arg(formattedCorrect);
+        }
+        case GradeOutcome::EmptyAnswer:
+        case GradeOutcome::InvalidAnswer:
+            return "Please arrange the tiles to form your answer";
+        default:
+            return "Error: Invalid exercise type for TileOrderGrader";
     }
 }
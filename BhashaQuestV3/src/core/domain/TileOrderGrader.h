@@ -16,9 +16,10 @@ public:
      * Grade tile order answer
      * @param userAnswer - User's tile sequence as space-separated string
      * @param exercise - The TileOrder exercise being graded
-     * @return Result with correct flag, score, and feedback
+     * @return Outcome with status and score (feedback() builds the message)
      */
-    Result grade(const QString& userAnswer, const Exercise* exercise) override;
+    GradeOutcome evaluate(const QString& userAnswer, const Exercise* exercise) const override;
+    QString feedback(const GradeOutcome& outcome, const Exercise* exercise) const override;
 };
 
 #endif // TILEORDERGRADER_H
@@ -1,22 +1,26 @@
 #include "TranslateExercise.h"
-#include <QVBoxLayout>
-#include <QLabel>
-#include <QLineEdit>
+#include "CharacterSetRegistry.h"
+#include "AnswerNormalizer.h"
 
 TranslateExercise::TranslateExercise()
-    : targetLanguage("Nepali")
+    : Exercise(ExerciseKind::Translate)
+    , targetLanguage("Nepali")
+    , characterSetId(CharacterSetRegistry::kNoCharacterSet)
     , characterSelectionEnabled(false) {
     type = "Translate";
 }
 
 TranslateExercise::TranslateExercise(const QString& id, const QString& englishPhrase,
                                      const QStringList& correctAnswers, const QString& targetLanguage)
-    : englishPhrase(englishPhrase), correctAnswers(correctAnswers), targetLanguage(targetLanguage) {
+    : Exercise(ExerciseKind::Translate)
+    , englishPhrase(englishPhrase), correctAnswers(correctAnswers), targetLanguage(targetLanguage)
+    , characterSetId(CharacterSetRegistry::kNoCharacterSet) {
     characterSelectionEnabled = false;
     this->id = id;
     this->type = "Translate";
     this->prompt = QString("Translate to %1: %2").arg(targetLanguage, englishPhrase);
     this->difficulty = 2; // Default difficulty
+    compileAnswerTrie();
 }
 
 QString TranslateExercise::getPrompt() const {
@@ -38,42 +42,37 @@ QString TranslateExercise::getType() const {
     return type;
 }
 
-QWidget* TranslateExercise::renderUI(QWidget* parent) {
-    QWidget* widget = new QWidget(parent);
-    QVBoxLayout* layout = new QVBoxLayout(widget);
-
-    // Add prompt label
-    QLabel* promptLabel = new QLabel(getPrompt(), widget);
-    promptLabel->setWordWrap(true);
-    promptLabel->setStyleSheet("font-size: 14pt; font-weight: bold; margin-bottom: 10px;");
-    layout->addWidget(promptLabel);
-
-    // Add instruction label
-    QLabel* instructionLabel = new QLabel(
-        QString("Type your answer in %1:").arg(targetLanguage), widget);
-    instructionLabel->setStyleSheet("font-size: 11pt; color: gray; margin-bottom: 5px;");
-    layout->addWidget(instructionLabel);
-
-    // Add input field
-    QLineEdit* inputField = new QLineEdit(widget);
-    inputField->setPlaceholderText("Your translation...");
-    inputField->setStyleSheet("font-size: 12pt; padding: 8px;");
-    inputField->setObjectName("translationInput"); // For easy access later
-    layout->addWidget(inputField);
-
-    layout->addStretch();
-    widget->setLayout(layout);
+void TranslateExercise::setCorrectAnswers(const QStringList& answers) {
+    correctAnswers = answers;
+    compileAnswerTrie();
+}
 
-    return widget;
+void TranslateExercise::compileAnswerTrie() {
+    // Done once at content load so grading never re-normalizes answers or rebuilds the trie
+    QStringList normalizedAnswers;
+    normalizedAnswers.reserve(correctAnswers.size());
+    for (const QString& answer : correctAnswers) {
+        normalizedAnswers.append(AnswerNormalizer::normalize(answer));
+    }
+    answerTrie = AnswerTrie(normalizedAnswers);
 }
 
 void TranslateExercise::setCharacterSet(const QStringList& characters) {
-    characterSet = characters;
-    if (!characterSet.isEmpty()) {
+    // Identical alphabets of the same language share one registry entry
+    setCharacterSetId(CharacterSetRegistry::getInstance().intern(targetLanguage, characters));
+}
+
+void TranslateExercise::setCharacterSetId(int id) {
+    characterSetId = id;
+    if (characterSetId != CharacterSetRegistry::kNoCharacterSet) {
         characterSelectionEnabled = true;
     }
 }
 
+const CharacterSet* TranslateExercise::getCharacterSet() const {
+    return CharacterSetRegistry::getInstance().get(characterSetId);
+}
+
 void TranslateExercise::enableCharacterSelection(bool enabled) {
-    characterSelectionEnabled = enabled && !characterSet.isEmpty();
+    characterSelectionEnabled = enabled && characterSetId != CharacterSetRegistry::kNoCharacterSet;
 }
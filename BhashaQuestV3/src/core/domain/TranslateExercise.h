@@ -2,8 +2,11 @@
 #define TRANSLATEEXERCISE_H
 
 #include "Exercise.h"
+#include "AnswerTrie.h"
 #include <QStringList>
 
+class CharacterSet;
+
 /**
  * TranslateExercise - Translation exercise type
  *
@@ -15,8 +18,9 @@ class TranslateExercise : public Exercise {
 private:
     QString englishPhrase;              // Phrase to translate
     QStringList correctAnswers;         // Multiple valid answers (native + romanization)
+    AnswerTrie answerTrie;              // Normalized correctAnswers, compiled for the grader
     QString targetLanguage;             // Target language name
-    QStringList characterSet;           // Available characters for script entry
+    int characterSetId;                 // CharacterSetRegistry id of the script's characters
     bool characterSelectionEnabled;     // Flag to show character picker
 
 public:
@@ -28,21 +32,26 @@ public:
     QString getPrompt() const override;
     QString getCorrectAnswer() const override;
     QString getType() const override;
-    QWidget* renderUI(QWidget* parent = nullptr) override;
 
     // Translate-specific methods
     QString getEnglishPhrase() const { return englishPhrase; }
     QStringList getCorrectAnswers() const { return correctAnswers; }
+    const AnswerTrie& getAnswerTrie() const { return answerTrie; }
     QString getTargetLanguage() const { return targetLanguage; }
 
     void setEnglishPhrase(const QString& phrase) { englishPhrase = phrase; }
-    void setCorrectAnswers(const QStringList& answers) { correctAnswers = answers; }
+    void setCorrectAnswers(const QStringList& answers);
     void setTargetLanguage(const QString& language) { targetLanguage = language; }
     void setPrompt(const QString& newPrompt) { prompt = newPrompt; }
     void setCharacterSet(const QStringList& characters);
-    QStringList getCharacterSet() const { return characterSet; }
+    void setCharacterSetId(int id);
+    int getCharacterSetId() const { return characterSetId; }
+    const CharacterSet* getCharacterSet() const;
     void enableCharacterSelection(bool enabled);
     bool usesCharacterSelection() const { return characterSelectionEnabled; }
+
+private:
+    void compileAnswerTrie();
 };
 
 #endif // TRANSLATEEXERCISE_H
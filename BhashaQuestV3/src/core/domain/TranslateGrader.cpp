@@ -1,49 +1,117 @@
 #include "TranslateGrader.h"
+#include "AnswerNormalizer.h"
 #include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+/**
+ * A plain answer list in the forms fuzzyMatch compares, built once per list
+ */
+struct CompiledAnswers {
+    QStringList source;
+    QStringList normalized;
+    QVector<ClusterText> weighted;      // Answers in a script with a confusion table
+};
+
+const CompiledAnswers& compileAnswers(const QStringList& answers) {
+    // Callers grade one list many times in a row; comparing a shared copy is a
+    // pointer check, so normalizing and segmenting only happens when it changes
+    thread_local CompiledAnswers compiled;
+    if (compiled.source == answers) {
+        return compiled;
+    }
+
+    compiled.source = answers;
+    compiled.normalized.clear();
+    compiled.weighted.clear();
+    for (const QString& answer : answers) {
+        const QString normalizedAnswer = AnswerNormalizer::normalize(answer);
+        compiled.normalized.append(normalizedAnswer);
+
+        ClusterText clusters(normalizedAnswer);
+        if (clusters.hasWeightedScript()) {
+            compiled.weighted.append(clusters);
+        }
+    }
+    return compiled;
+}
 
-Result TranslateGrader::grade(const QString& userAnswer, const Exercise* exercise) {
-    // Cast to TranslateExercise to access Translate-specific methods
-    const TranslateExercise* translateEx = dynamic_cast<const TranslateExercise*>(exercise);
+} // namespace
 
-    if (!translateEx) {
-        return Result(false, 0, "Error: Invalid exercise type for TranslateGrader");
+GradeOutcome TranslateGrader::evaluate(const QString& userAnswer, const Exercise* exercise) const {
+    // Check the type tag, then cast to TranslateExercise to access Translate-specific methods
+    if (!exercise || exercise->getKind() != ExerciseKind::Translate) {
+        return GradeOutcome(GradeOutcome::InvalidExercise);
     }
+    const TranslateExercise* translateEx = static_cast<const TranslateExercise*>(exercise);
 
     QString trimmedAnswer = userAnswer.trimmed();
 
     if (trimmedAnswer.isEmpty()) {
-        return Result(false, 0, "Please enter a translation");
+        return GradeOutcome(GradeOutcome::EmptyAnswer);
     }
 
-    // Get all correct answers
-    QStringList correctAnswers = translateEx->getCorrectAnswers();
-
-    // Check for fuzzy match against any correct answer
-    bool correct = fuzzyMatch(trimmedAnswer, correctAnswers);
+    // Check for fuzzy match against any correct answer (compiled at content load)
+    bool correct = fuzzyMatch(trimmedAnswer, translateEx->getAnswerTrie());
 
     if (correct) {
-        return Result(true, 10, QString("Correct! Well done!"));
-    } else {
-        QString correctAnswer = translateEx->getCorrectAnswer();
-        return Result(false, 0, QString("Incorrect. Correct answer: %1").arg(correctAnswer));
+        return GradeOutcome(GradeOutcome::Correct, 10);
     }
+    return GradeOutcome(GradeOutcome::Incorrect);
 }
 
-bool TranslateGrader::fuzzyMatch(const QString& userAnswer, const QStringList& correctAnswers) const {
-    for (const QString& correctAnswer : correctAnswers) {
-        // Exact match (case-sensitive for native scripts)
-        if (userAnswer == correctAnswer) {
+QString TranslateGrader::feedback(const GradeOutcome& outcome, const Exercise* exercise) const {
+    switch (outcome.status) {
+        case GradeOutcome::Correct:
+            return "Correct! Well done!";
+        case GradeOutcome::Incorrect:
+            return QString("Incorrect. Correct answer: %1").arg(exercise->getCorrectAnswer());
+        case GradeOutcome::EmptyAnswer:
+        case GradeOutcome::InvalidAnswer:
+            return "Please enter a translation";
+        default:
+            return "Error: Invalid exercise type for TranslateGrader";
+    }
+}
+
+QString TranslateGrader::canonicalAnswer(const QString& userAnswer) const {
+    // evaluate() only tells whitespace-only input apart from the rest; every
+    // other answer is graded on its normalized form
+    const QString normalizedAnswer = AnswerNormalizer::normalize(userAnswer);
+    return normalizedAnswer.isEmpty() ? userAnswer : normalizedAnswer;
+}
+
+bool TranslateGrader::fuzzyMatch(const QString& userAnswer, const QStringList& correctAnswers) {
+    const QString normalizedAnswer = AnswerNormalizer::normalize(userAnswer);
+
+    // Ad-hoc lists are not precompiled by the exercise, so compile them here
+    const CompiledAnswers& compiled = compileAnswers(correctAnswers);
+
+    for (const QString& normalizedCorrect : compiled.normalized) {
+        // Exact match after normalization (case, whitespace, joiners, NFC)
+        if (normalizedAnswer == normalizedCorrect) {
             return true;
         }
 
-        // Case-insensitive match (for romanization)
-        if (userAnswer.toLower() == correctAnswer.toLower()) {
+        // Fuzzy match with Levenshtein distance <= 2 (allow minor typos)
+        if (boundedEditDistance(normalizedAnswer, normalizedCorrect, kMaxTypos) <= kMaxTypos) {
             return true;
         }
+    }
 
-        // Fuzzy match with Levenshtein distance <= 2 (allow minor typos)
-        int distance = levenshteinDistance(userAnswer.toLower(), correctAnswer.toLower());
-        if (distance <= 2) {
+    // Same confusion-weighted second chance as the AnswerTrie path
+    if (compiled.weighted.isEmpty()) {
+        return false;
+    }
+    const ClusterText answerClusters(normalizedAnswer);
+    if (!answerClusters.hasWeightedScript()) {
+        return false;
+    }
+    const int maxCost = kMaxTypos * ClusterDistance::kEditCost;
+    for (const ClusterText& correctClusters : compiled.weighted) {
+        if (ClusterDistance::boundedDistance(answerClusters, correctClusters, maxCost) <= maxCost) {
             return true;
         }
     }
@@ -51,33 +119,75 @@ bool TranslateGrader::fuzzyMatch(const QString& userAnswer, const QStringList& c
     return false;
 }
 
-int TranslateGrader::levenshteinDistance(const QString& s1, const QString& s2) const {
-    int len1 = s1.length();
-    int len2 = s2.length();
+bool TranslateGrader::fuzzyMatch(const QString& userAnswer, const AnswerTrie& answerTrie) {
+    // The only allocation: answers were normalized when the exercise was built
+    const QString normalizedAnswer = AnswerNormalizer::normalize(userAnswer);
+
+    // Exact match first, then Levenshtein distance <= 2 (allow minor typos)
+    // against every accepted answer at once
+    if (answerTrie.matches(normalizedAnswer, kMaxTypos)) {
+        return true;
+    }
+
+    // Confusable slips in Nepali/Kannada script cost less than a full typo
+    return answerTrie.hasWeightedAnswers()
+        && answerTrie.matchesWeighted(normalizedAnswer, kMaxTypos * ClusterDistance::kEditCost);
+}
 
-    // Create distance matrix
-    std::vector<std::vector<int>> matrix(len1 + 1, std::vector<int>(len2 + 1));
+int TranslateGrader::boundedEditDistance(const QString& s1, const QString& s2, int maxDistance) {
+    const int len1 = s1.length();
+    const int len2 = s2.length();
+    const int outOfReach = maxDistance + 1;
 
-    // Initialize first row and column
-    for (int i = 0; i <= len1; ++i) {
-        matrix[i][0] = i;
+    // Every length difference costs at least one insertion or deletion
+    if (std::abs(len1 - len2) > maxDistance) {
+        return outOfReach;
     }
+
+    const QChar* a = s1.constData();
+    const QChar* b = s2.constData();
+
+    // One row of the distance matrix, reused across calls on this thread.
+    // Cells outside the band |i - j| <= maxDistance are never computed and
+    // hold outOfReach, since any path through them costs more than maxDistance.
+    thread_local std::vector<int> row;
+    row.resize(len2 + 1);
     for (int j = 0; j <= len2; ++j) {
-        matrix[0][j] = j;
+        row[j] = (j <= maxDistance) ? j : outOfReach;
     }
 
-    // Calculate distances
     for (int i = 1; i <= len1; ++i) {
-        for (int j = 1; j <= len2; ++j) {
-            int cost = (s1[i - 1] == s2[j - 1]) ? 0 : 1;
-
-            matrix[i][j] = std::min({
-                matrix[i - 1][j] + 1,      // Deletion
-                matrix[i][j - 1] + 1,      // Insertion
-                matrix[i - 1][j - 1] + cost // Substitution
+        const int first = std::max(1, i - maxDistance);
+        const int last = std::min(len2, i + maxDistance);
+
+        int diagonal = row[first - 1];                                    // D[i-1][first-1]
+        int left = (first == 1) ? std::min(i, outOfReach) : outOfReach;   // D[i][first-1]
+        row[first - 1] = left;
+        int bandMinimum = left;
+
+        for (int j = first; j <= last; ++j) {
+            const int up = row[j];                                        // D[i-1][j]
+            const int cost = (a[i - 1] == b[j - 1]) ? 0 : 1;
+
+            int distance = std::min({
+                diagonal + cost,    // Substitution
+                up + 1,             // Deletion
+                left + 1            // Insertion
             });
+            distance = std::min(distance, outOfReach);
+
+            diagonal = up;
+            row[j] = distance;
+            left = distance;
+            bandMinimum = std::min(bandMinimum, distance);
+        }
+
+        // Every alignment passes through this row; if the whole band is over
+        // the limit, so is the final distance
+        if (bandMinimum > maxDistance) {
+            return outOfReach;
         }
     }
 
-    return matrix[len1][len2];
+    return std::min(row[len2], outOfReach);
 }
@@ -10,8 +10,15 @@
  * DESIGN PATTERN: Strategy Pattern (Concrete Strategy)
  * Grading logic: Fuzzy matching with multiple valid answers
  * - Accepts native script or romanization
- * - Case-insensitive for romanization
+ * - Compares AnswerNormalizer forms: case-folded, NFC, whitespace collapsed,
+ *   zero-width joiners removed
  * - Allows minor typos (Levenshtein distance <= 2)
+ * - In Devanagari and Kannada, also accepts answers within 2 edits by
+ *   ClusterDistance, where confusable letters and vowel signs cost less
+ *
+ * Exercises carry their answers precompiled as an AnswerTrie, so all spelling
+ * variants are matched in one walk; plain string lists use a banded bounded DP,
+ * and are normalized and segmented once per list rather than once per answer.
  */
 class TranslateGrader : public StrategyGrader {
 public:
@@ -19,21 +26,44 @@ public:
      * Grade translation answer
      * @param userAnswer - User's translation
      * @param exercise - The Translate exercise being graded
-     * @return Result with correct flag, score, and feedback
+     * @return Outcome with status and score (feedback() builds the message)
      */
-    Result grade(const QString& userAnswer, const Exercise* exercise) override;
+    GradeOutcome evaluate(const QString& userAnswer, const Exercise* exercise) const override;
+    QString feedback(const GradeOutcome& outcome, const Exercise* exercise) const override;
 
-private:
     /**
-     * Calculate Levenshtein distance between two strings
-     * Used for fuzzy matching to allow minor typos
+     * The AnswerNormalizer form, so "Namaste " and "namaste" share a cache entry
+     * (answers that normalize to nothing keep their own form: they may be empty)
      */
-    int levenshteinDistance(const QString& s1, const QString& s2) const;
+    QString canonicalAnswer(const QString& userAnswer) const override;
 
     /**
      * Check if user answer matches any correct answer (with fuzzy matching)
+     * Static so the same rule can be applied without a grader instance
+     */
+    static bool fuzzyMatch(const QString& userAnswer, const QStringList& correctAnswers);
+
+    /**
+     * Same rule as above against precompiled answers (TranslateExercise::getAnswerTrie())
+     * The user answer is normalized once and checked against every accepted
+     * answer in a single pass, whatever the number of variants.
      */
-    bool fuzzyMatch(const QString& userAnswer, const QStringList& correctAnswers) const;
+    static bool fuzzyMatch(const QString& userAnswer, const AnswerTrie& answerTrie);
+
+    /**
+     * Levenshtein distance between two strings, computed only as far as needed
+     * to tell whether it is at most maxDistance
+     *
+     * Only the diagonal band of width 2 * maxDistance + 1 is filled, in a single
+     * reusable row; the computation stops as soon as the whole band exceeds
+     * maxDistance, and strings whose lengths differ by more are rejected up front.
+     *
+     * @return The distance if it is <= maxDistance, otherwise maxDistance + 1
+     */
+    static int boundedEditDistance(const QString& s1, const QString& s2, int maxDistance);
+
+    // Typos accepted by fuzzyMatch
+    static const int kMaxTypos = 2;
 };
 
 #endif // TRANSLATEGRADER_H
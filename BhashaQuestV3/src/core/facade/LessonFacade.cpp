@@ -21,6 +21,12 @@ LessonFacade::LessonFacade(AppController* controller, ContentRepository* reposit
             this, &LessonFacade::lessonCompleted);
     connect(controller, &AppController::profileUpdated,
             this, &LessonFacade::profileUpdated);
+
+    // Cached grades of edited exercises must not outlive the old content
+    if (repository) {
+        connect(repository, &ContentRepository::contentReloaded,
+                this, &LessonFacade::handleContentReloaded);
+    }
 }
 
 bool LessonFacade::initializeSkillSession(const QString& skillId) {
@@ -89,3 +95,9 @@ void LessonFacade::handleAnswerGraded(const Result& result) {
 
     emit answerGraded(result);
 }
+
+void LessonFacade::handleContentReloaded(const QStringList& changedSkillIds) {
+    if (controller && controller->getGradeCache()) {
+        controller->getGradeCache()->invalidateSkills(changedSkillIds);
+    }
+}
@@ -46,6 +46,7 @@ signals:
 
 private slots:
     void handleAnswerGraded(const Result& result);
+    void handleContentReloaded(const QStringList& changedSkillIds);
 
 private:
     AppController* controller;
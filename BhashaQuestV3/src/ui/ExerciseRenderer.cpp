@@ -0,0 +1,140 @@
+#include "ExerciseRenderer.h"
+#include "../core/domain/MCQExercise.h"
+#include "../core/domain/TranslateExercise.h"
+#include "../core/domain/TileOrderExercise.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QRadioButton>
+#include <QButtonGroup>
+
+QWidget* ExerciseRenderer::render(const Exercise* exercise, QWidget* parent) {
+    if (!exercise) {
+        return nullptr;
+    }
+
+    switch (exercise->getKind()) {
+        case ExerciseKind::MCQ:
+            return renderMCQ(static_cast<const MCQExercise*>(exercise), parent);
+        case ExerciseKind::Translate:
+            return renderTranslate(static_cast<const TranslateExercise*>(exercise), parent);
+        case ExerciseKind::TileOrder:
+            return renderTileOrder(static_cast<const TileOrderExercise*>(exercise), parent);
+        case ExerciseKind::Unknown:
+            break;
+    }
+    return nullptr;
+}
+
+QWidget* ExerciseRenderer::renderMCQ(const MCQExercise* exercise, QWidget* parent) {
+    QWidget* widget = new QWidget(parent);
+    QVBoxLayout* layout = new QVBoxLayout(widget);
+
+    // Add prompt label
+    QLabel* promptLabel = new QLabel(exercise->getPrompt(), widget);
+    promptLabel->setWordWrap(true);
+    promptLabel->setStyleSheet("font-size: 14pt; font-weight: bold; margin-bottom: 10px;");
+    layout->addWidget(promptLabel);
+
+    // Add radio buttons for options
+    const QStringList options = exercise->getOptions();
+    QButtonGroup* buttonGroup = new QButtonGroup(widget);
+    for (int i = 0; i < options.size(); ++i) {
+        QRadioButton* radioButton = new QRadioButton(options[i], widget);
+        radioButton->setStyleSheet("font-size: 12pt; padding: 5px;");
+        buttonGroup->addButton(radioButton, i);
+        layout->addWidget(radioButton);
+    }
+
+    layout->addStretch();
+    widget->setLayout(layout);
+
+    return widget;
+}
+
+QWidget* ExerciseRenderer::renderTranslate(const TranslateExercise* exercise, QWidget* parent) {
+    QWidget* widget = new QWidget(parent);
+    QVBoxLayout* layout = new QVBoxLayout(widget);
+
+    // Add prompt label
+    QLabel* promptLabel = new QLabel(exercise->getPrompt(), widget);
+    promptLabel->setWordWrap(true);
+    promptLabel->setStyleSheet("font-size: 14pt; font-weight: bold; margin-bottom: 10px;");
+    layout->addWidget(promptLabel);
+
+    // Add instruction label
+    QLabel* instructionLabel = new QLabel(
+        QString("Type your answer in %1:").arg(exercise->getTargetLanguage()), widget);
+    instructionLabel->setStyleSheet("font-size: 11pt; color: gray; margin-bottom: 5px;");
+    layout->addWidget(instructionLabel);
+
+    // Add input field
+    QLineEdit* inputField = new QLineEdit(widget);
+    inputField->setPlaceholderText("Your translation...");
+    inputField->setStyleSheet("font-size: 12pt; padding: 8px;");
+    inputField->setObjectName("translationInput"); // For easy access later
+    layout->addWidget(inputField);
+
+    layout->addStretch();
+    widget->setLayout(layout);
+
+    return widget;
+}
+
+QWidget* ExerciseRenderer::renderTileOrder(const TileOrderExercise* exercise, QWidget* parent) {
+    QWidget* widget = new QWidget(parent);
+    QVBoxLayout* layout = new QVBoxLayout(widget);
+
+    // Add prompt label
+    QLabel* promptLabel = new QLabel(exercise->getPrompt(), widget);
+    promptLabel->setWordWrap(true);
+    promptLabel->setStyleSheet("font-size: 14pt; font-weight: bold; margin-bottom: 10px;");
+    layout->addWidget(promptLabel);
+
+    // Add instruction label
+    QLabel* instructionLabel = new QLabel("Tap the tiles in the correct order:", widget);
+    instructionLabel->setStyleSheet("font-size: 11pt; color: gray; margin-bottom: 10px;");
+    layout->addWidget(instructionLabel);
+
+    // Add tiles container
+    QWidget* tilesContainer = new QWidget(widget);
+    QHBoxLayout* tilesLayout = new QHBoxLayout(tilesContainer);
+    tilesLayout->setSpacing(10);
+
+    for (const QString& tile : exercise->getTiles()) {
+        QPushButton* tileButton = new QPushButton(tile, tilesContainer);
+        tileButton->setStyleSheet(
+            "QPushButton {"
+            "   font-size: 12pt;"
+            "   padding: 10px 15px;"
+            "   background-color: #e0e0e0;"
+            "   border: 2px solid #999;"
+            "   border-radius: 5px;"
+            "}"
+            "QPushButton:hover {"
+            "   background-color: #d0d0d0;"
+            "}"
+            "QPushButton:pressed {"
+            "   background-color: #4CAF50;"
+            "   color: white;"
+            "}"
+        );
+        tilesLayout->addWidget(tileButton);
+    }
+
+    tilesContainer->setLayout(tilesLayout);
+    layout->addWidget(tilesContainer);
+
+    // Add selected order display
+    QLabel* selectedLabel = new QLabel("Selected order: ", widget);
+    selectedLabel->setObjectName("selectedOrderLabel");
+    selectedLabel->setStyleSheet("font-size: 11pt; margin-top: 10px;");
+    layout->addWidget(selectedLabel);
+
+    layout->addStretch();
+    widget->setLayout(layout);
+
+    return widget;
+}
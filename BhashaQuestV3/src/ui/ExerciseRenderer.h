@@ -0,0 +1,36 @@
+#ifndef EXERCISERENDERER_H
+#define EXERCISERENDERER_H
+
+#include <QWidget>
+#include "../core/domain/Exercise.h"
+
+class MCQExercise;
+class TranslateExercise;
+class TileOrderExercise;
+
+/**
+ * ExerciseRenderer - UI adapter that builds widgets for exercises
+ *
+ * ARCHITECTURE: UI Layer
+ * Purpose: Keeps Qt Widgets out of the domain layer. Exercise classes only hold
+ * data; this adapter turns them into a standalone widget, dispatching on the
+ * exercise's ExerciseKind tag. The domain, data and controller layers can then be
+ * built as the QtCore-only bhasha_core library and used by headless tools.
+ *
+ * Usage: QWidget* widget = ExerciseRenderer::render(exercise, parent);
+ */
+class ExerciseRenderer {
+public:
+    /**
+     * Render UI elements for an exercise
+     * @return Widget containing the exercise UI, or nullptr for an unknown kind
+     */
+    static QWidget* render(const Exercise* exercise, QWidget* parent = nullptr);
+
+private:
+    static QWidget* renderMCQ(const MCQExercise* exercise, QWidget* parent);
+    static QWidget* renderTranslate(const TranslateExercise* exercise, QWidget* parent);
+    static QWidget* renderTileOrder(const TileOrderExercise* exercise, QWidget* parent);
+};
+
+#endif // EXERCISERENDERER_H
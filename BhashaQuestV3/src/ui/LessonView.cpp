@@ -2,6 +2,7 @@
 #include "widgets/CharacterSelectionWidget.h"
 #include "../core/domain/MCQExercise.h"
 #include "../core/domain/TranslateExercise.h"
+#include "../core/domain/CharacterSet.h"
 #include "../core/domain/TileOrderExercise.h"
 #include "../core/domain/AudioManager.h"
 #include <QMessageBox>
@@ -18,12 +19,17 @@ LessonView::LessonView(QWidget* parent)
     : QWidget(parent)
     , mcqButtonGroup(nullptr)
     , translateInput(nullptr)
+    , liveMatchLabel(nullptr)
+    , liveChecker(nullptr)
     , characterSelectionWidget(nullptr)
     , tileListWidget(nullptr)
     , nextLessonButton(nullptr)
     , currentExercise(nullptr)
 {
     setupUI();
+
+    liveChecker = new LiveAnswerChecker(this);
+    connect(liveChecker, &LiveAnswerChecker::matchChanged, this, &LessonView::onLiveMatchChanged);
 }
 
 LessonView::~LessonView() {
@@ -382,8 +388,8 @@ void LessonView::updateExercise(Exercise* exercise) {
     }
 
     // Update exercise type badge
-    QString type = exercise->getType();
-    if (type == "MCQ") {
+    const ExerciseKind kind = exercise->getKind();
+    if (kind == ExerciseKind::MCQ) {
         typeLabel->setText("🎯 Multiple Choice");
         typeLabel->setStyleSheet(
             "QLabel { background-color: #FF9800; color: white; "
@@ -391,7 +397,7 @@ void LessonView::updateExercise(Exercise* exercise) {
             "font-size: 11px; font-weight: bold; }"
         );
         createMCQWidgets(exercise);
-    } else if (type == "Translate") {
+    } else if (kind == ExerciseKind::Translate) {
         typeLabel->setText("✍️ Translation");
         typeLabel->setStyleSheet(
             "QLabel { background-color: #9C27B0; color: white; "
@@ -399,7 +405,7 @@ void LessonView::updateExercise(Exercise* exercise) {
             "font-size: 11px; font-weight: bold; }"
         );
         createTranslateWidgets(exercise);
-    } else if (type == "TileOrder") {
+    } else if (kind == ExerciseKind::TileOrder) {
         typeLabel->setText("🔤 Word Order");
         typeLabel->setStyleSheet(
             "QLabel { background-color: #00BCD4; color: white; "
@@ -408,7 +414,7 @@ void LessonView::updateExercise(Exercise* exercise) {
         );
         createTileOrderWidgets(exercise);
     } else {
-        promptLabel->setText("Unknown exercise type: " + type);
+        promptLabel->setText("Unknown exercise type: " + exercise->getType());
     }
 
     // Add fade-in animation
@@ -585,6 +591,30 @@ void LessonView::onNextClicked() {
     emit nextExerciseRequested();
 }
 
+void LessonView::onLiveMatchChanged(IncrementalMatcher::Match match) {
+    if (!liveMatchLabel) {
+        return;
+    }
+
+    switch (match) {
+        case IncrementalMatcher::Exact:
+            liveMatchLabel->setText("✅ Exact match");
+            liveMatchLabel->setStyleSheet("QLabel { color: #2E7D32; font-size: 12px; margin-top: 4px; }");
+            break;
+        case IncrementalMatcher::Close:
+            liveMatchLabel->setText("👌 Close - minor typo");
+            liveMatchLabel->setStyleSheet("QLabel { color: #558B2F; font-size: 12px; margin-top: 4px; }");
+            break;
+        case IncrementalMatcher::OnTrack:
+            liveMatchLabel->setText("✏️ On track...");
+            liveMatchLabel->setStyleSheet("QLabel { color: #666; font-size: 12px; margin-top: 4px; }");
+            break;
+        default:
+            liveMatchLabel->setText("");
+            break;
+    }
+}
+
 void LessonView::clearInputWidgets() {
     if (mcqButtonGroup) {
         delete mcqButtonGroup;
@@ -593,6 +623,7 @@ void LessonView::clearInputWidgets() {
     qDeleteAll(mcqRadioButtons);
     mcqRadioButtons.clear();
 
+    liveChecker->setExercise(nullptr);
     if (translateInput) {
         delete translateInput;
         translateInput = nullptr;
@@ -612,6 +643,7 @@ void LessonView::clearInputWidgets() {
         delete item;
     }
     characterSelectionWidget = nullptr;
+    liveMatchLabel = nullptr;
 }
 
 void LessonView::createMCQWidgets(Exercise* exercise) {
@@ -665,7 +697,8 @@ void LessonView::createTranslateWidgets(Exercise* exercise) {
         return;
     }
 
-    if (translateExercise->usesCharacterSelection() && !translateExercise->getCharacterSet().isEmpty()) {
+    const CharacterSet* characterSet = translateExercise->getCharacterSet();
+    if (translateExercise->usesCharacterSelection() && characterSet && !characterSet->isEmpty()) {
         QLabel* instructionLabel = new QLabel(
             QString("Tap the characters in order to build the answer in %1:").arg(
                 translateExercise->getTargetLanguage()), inputContainer);
@@ -675,7 +708,7 @@ void LessonView::createTranslateWidgets(Exercise* exercise) {
 
         characterSelectionWidget = new CharacterSelectionWidget(
             translateExercise->getCorrectAnswer(),
-            translateExercise->getCharacterSet(),
+            characterSet,
             translateExercise->getTargetLanguage(),
             inputContainer);
         inputLayout->addWidget(characterSelectionWidget);
@@ -704,6 +737,14 @@ void LessonView::createTranslateWidgets(Exercise* exercise) {
 
     connect(translateInput, &QLineEdit::returnPressed, this, &LessonView::onSubmitClicked);
     inputLayout->addWidget(translateInput);
+
+    // Live hint, filled in by LiveAnswerChecker while the user types
+    liveMatchLabel = new QLabel("", inputContainer);
+    liveMatchLabel->setStyleSheet("QLabel { color: #666; font-size: 12px; margin-top: 4px; }");
+    inputLayout->addWidget(liveMatchLabel);
+
+    liveChecker->setExercise(translateExercise);
+    connect(translateInput, &QLineEdit::textChanged, liveChecker, &LiveAnswerChecker::updateInput);
     translateInput->setFocus();
 }
 
@@ -769,9 +810,9 @@ QString LessonView::collectAnswer() const {
         return QString();
     }
 
-    QString type = currentExercise->getType();
+    const ExerciseKind kind = currentExercise->getKind();
 
-    if (type == "MCQ") {
+    if (kind == ExerciseKind::MCQ) {
         if (mcqButtonGroup) {
             int selectedId = mcqButtonGroup->checkedId();
             if (selectedId >= 0) {
@@ -779,7 +820,7 @@ QString LessonView::collectAnswer() const {
             }
         }
     }
-    else if (type == "Translate") {
+    else if (kind == ExerciseKind::Translate) {
         if (characterSelectionWidget) {
             return characterSelectionWidget->getSelectedSequence();
         }
@@ -787,7 +828,7 @@ QString LessonView::collectAnswer() const {
             return translateInput->text().trimmed();
         }
     }
-    else if (type == "TileOrder") {
+    else if (kind == ExerciseKind::TileOrder) {
         if (tileListWidget) {
             QStringList orderedTiles;
             for (int i = 0; i < tileListWidget->count(); ++i) {
@@ -16,6 +16,7 @@
 #include "../core/domain/Exercise.h"
 #include "../core/domain/Result.h"
 #include "../core/domain/TranslateExercise.h"
+#include "../core/controllers/LiveAnswerChecker.h"
 
 /**
  * LessonView - Main UI component for displaying and interacting with exercises
@@ -71,6 +72,8 @@ private:
 
     // Translate-specific widgets
     QLineEdit* translateInput;          // Text input for translation
+    QLabel* liveMatchLabel;             // As-you-type hint under translateInput
+    LiveAnswerChecker* liveChecker;     // Checks translateInput off the GUI thread
 
     CharacterSelectionWidget* characterSelectionWidget; // Character picker for script entry
 
@@ -148,6 +151,12 @@ private slots:
      */
     void onNextClicked();
 
+    /**
+     * Show the live hint for the text typed so far
+     * @param match - LiveAnswerChecker's verdict for the current input
+     */
+    void onLiveMatchChanged(IncrementalMatcher::Match match);
+
 private:
     /**
      * Initialize UI components
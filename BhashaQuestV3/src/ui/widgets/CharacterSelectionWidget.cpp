@@ -11,7 +11,7 @@
 
 CharacterSelectionWidget::CharacterSelectionWidget(
     const QString& correctAnswer,
-    const QStringList& languageCharacterSet,
+    const CharacterSet* languageCharacterSet,
     const QString& targetLanguage,
     QWidget* parent)
     : QWidget(parent),
@@ -36,7 +36,7 @@ CharacterSelectionWidget::CharacterSelectionWidget(
         return;
     }
 
-    if (languageCharacterSet.isEmpty()) {
+    if (!languageCharacterSet || languageCharacterSet->isEmpty()) {
         qWarning() << "CharacterSelectionWidget: languageCharacterSet is empty";
         if (selectedLabel) selectedLabel->setText("Error: No character set available");
         setStyleSheet("background-color: #ffebee;");
@@ -45,7 +45,7 @@ CharacterSelectionWidget::CharacterSelectionWidget(
 
     try {
         // Generate character bank
-        characterBank = CharacterUtils::generateCharacterBank(correctAnswer, languageCharacterSet);
+        characterBank = CharacterUtils::generateCharacterBank(correctAnswer, *languageCharacterSet);
 
         if (characterBank.isEmpty()) {
             qWarning() << "CharacterSelectionWidget: Generated character bank is empty";
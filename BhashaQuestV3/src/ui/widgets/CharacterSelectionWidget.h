@@ -9,6 +9,8 @@
 #include <QStringList>
 #include <QList>
 
+class CharacterSet;
+
 /**
  * CharacterSelectionWidget - UI component for character selection exercises
  *
@@ -33,7 +35,7 @@
  * └─────────────────────────────────┘
  *
  * Data Flow:
- * 1. Created by TranslateExercise::renderUI()
+ * 1. Created by LessonView::createTranslateWidgets()
  * 2. Constructor generates character bank from correct answer
  * 3. User clicks characters → selected sequence updated
  * 4. LessonView calls getSelectedSequence() → returns semicolon-separated chars
@@ -66,13 +68,13 @@ public:
      * Constructor - Initialize character selection widget
      *
      * @param correctAnswer The correct answer string (used to generate bank)
-     * @param languageCharacterSet Available characters for the target language
+     * @param languageCharacterSet Available characters for the target language (owned by CharacterSetRegistry)
      * @param targetLanguage Language name (e.g., "Nepali", "Kannada")
      * @param parent Parent widget
      */
     explicit CharacterSelectionWidget(
         const QString& correctAnswer,
-        const QStringList& languageCharacterSet,
+        const CharacterSet* languageCharacterSet,
         const QString& targetLanguage = "Nepali",
         QWidget* parent = nullptr
     );
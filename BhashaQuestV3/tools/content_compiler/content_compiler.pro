@@ -0,0 +1,17 @@
+QT       = core
+CONFIG  += c++17 console
+CONFIG  -= app_bundle
+
+TARGET = content_compiler
+
+SOURCES += \
+    main.cpp \
+    ../../src/core/data/ContentPack.cpp \
+    ../../src/core/data/ContentStreamReader.cpp \
+    ../../src/core/domain/ExerciseSpec.cpp
+
+HEADERS += \
+    ../../src/core/data/ContentPack.h \
+    ../../src/core/data/ContentStreamReader.h \
+    ../../src/core/domain/ExerciseSpec.h \
+    ../../src/core/domain/ExerciseKind.h
@@ -0,0 +1,62 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFileInfo>
+#include <QDir>
+#include <QTextStream>
+#include "../../src/core/data/ContentPack.h"
+
+/**
+ * content_compiler - Offline converter from content.json to content.bqpack
+ *
+ * Usage: content_compiler <content.json> [output.bqpack]
+ *
+ * Run it whenever content.json changes. ContentRepository prefers the pack
+ * and falls back to JSON when the pack is missing or older than the JSON.
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("content_compiler");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Compile BhashaQuest content.json into a binary content pack");
+    parser.addHelpOption();
+    parser.addPositionalArgument("input", "Source content.json");
+    parser.addPositionalArgument("output", "Pack to write (default: <input>.bqpack)");
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    const QStringList args = parser.positionalArguments();
+    if (args.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    const QString inputPath = args.at(0);
+    QString outputPath;
+    if (args.size() > 1) {
+        outputPath = args.at(1);
+    } else {
+        QFileInfo inputInfo(inputPath);
+        outputPath = inputInfo.dir().filePath(inputInfo.completeBaseName() + ".bqpack");
+    }
+
+    QString errorMessage;
+    if (!ContentPack::compile(inputPath, outputPath, &errorMessage)) {
+        err << "content_compiler: " << errorMessage << Qt::endl;
+        return 1;
+    }
+
+    // Re-open the result to make sure the running app will accept it
+    ContentPack pack;
+    if (!pack.open(outputPath, &errorMessage)) {
+        err << "content_compiler: wrote an unreadable pack: " << errorMessage << Qt::endl;
+        return 1;
+    }
+
+    out << "Wrote " << outputPath << ": " << pack.skillCount() << " skills, "
+        << pack.exerciseCount() << " exercises, " << QFileInfo(outputPath).size() << " bytes"
+        << Qt::endl;
+    return 0;
+}
@@ -0,0 +1,10 @@
+QT       = core
+CONFIG  += c++17 console
+CONFIG  -= app_bundle
+
+TARGET = grader_bench
+
+include(../../core.pri)
+
+SOURCES += \
+    main.cpp
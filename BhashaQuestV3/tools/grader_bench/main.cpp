@@ -0,0 +1,250 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <QStringList>
+#include <QVector>
+#include <algorithm>
+#include <vector>
+#include "../../src/core/domain/TranslateGrader.h"
+#include "../../src/core/domain/AnswerPattern.h"
+#include "../../src/core/domain/AnswerTrie.h"
+
+/**
+ * grader_bench - Microbenchmark for the Translate answer matcher
+ *
+ * Usage: grader_bench [--pairs N] [--length L] [--rounds R] [--seed S] [--variants V]
+ *
+ * Builds N (answer, reference) pairs of sentence-length romanized text
+ * (around L characters) with 0-4 random typos each, then times, with the
+ * grader's typo limit:
+ * - the full-matrix Levenshtein the grader used to run (baseline)
+ * - TranslateGrader::boundedEditDistance (banded DP)
+ * - AnswerPattern::boundedDistance (bit-parallel, patterns compiled up front
+ *   as they are at content load)
+ * All must agree on every pair; the tool exits with 1 if they do not.
+ *
+ * Then, for 1, 2, 4, ... up to V accepted spellings per answer, it compares
+ * testing each AnswerPattern in turn with AnswerTrie::matches (which walks the
+ * trie once there are more than AnswerTrie::kDirectMatchLimit spellings).
+ */
+
+namespace {
+
+// The previous TranslateGrader implementation, kept as the baseline
+int fullMatrixDistance(const QString& s1, const QString& s2) {
+    int len1 = s1.length();
+    int len2 = s2.length();
+
+    std::vector<std::vector<int>> matrix(len1 + 1, std::vector<int>(len2 + 1));
+    for (int i = 0; i <= len1; ++i) {
+        matrix[i][0] = i;
+    }
+    for (int j = 0; j <= len2; ++j) {
+        matrix[0][j] = j;
+    }
+
+    for (int i = 1; i <= len1; ++i) {
+        for (int j = 1; j <= len2; ++j) {
+            int cost = (s1[i - 1] == s2[j - 1]) ? 0 : 1;
+            matrix[i][j] = std::min({
+                matrix[i - 1][j] + 1,
+                matrix[i][j - 1] + 1,
+                matrix[i - 1][j - 1] + cost
+            });
+        }
+    }
+    return matrix[len1][len2];
+}
+
+QString randomSentence(QRandomGenerator& generator, int length) {
+    static const QStringList words = {
+        "ma", "timi", "hami", "pani", "khana", "khanchu", "janchu", "ghar", "bazar",
+        "namaste", "dhanyabad", "kasto", "cha", "ramro", "mitho", "aaja", "bholi",
+        "school", "kitab", "padhchu", "saathi", "sanga", "kathmandu", "jaanu", "parchha"
+    };
+
+    QString sentence;
+    while (sentence.length() < length) {
+        if (!sentence.isEmpty()) {
+            sentence += QLatin1Char(' ');
+        }
+        sentence += words.at(generator.bounded(words.size()));
+    }
+    return sentence;
+}
+
+QString withTypos(QRandomGenerator& generator, QString text, int typos) {
+    for (int t = 0; t < typos && !text.isEmpty(); ++t) {
+        const int position = generator.bounded(text.length());
+        const QChar letter(QLatin1Char('a' + generator.bounded(26)));
+        switch (generator.bounded(3)) {
+            case 0: text[position] = letter; break;         // Substitution
+            case 1: text.insert(position, letter); break;   // Insertion
+            default: text.remove(position, 1); break;       // Deletion
+        }
+    }
+    return text;
+}
+
+// Accepted spellings of one answer: the reference plus respellings of it
+QStringList spellingVariants(QRandomGenerator& generator, const QString& reference, int count) {
+    QStringList variants = {reference};
+    while (variants.size() < count) {
+        variants.append(withTypos(generator, reference, 3 + generator.bounded(3)));
+    }
+    return variants;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("grader_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Time the Translate grader's fuzzy answer matching");
+    parser.addHelpOption();
+    parser.addOption({"pairs", "Number of answer/reference pairs", "N", "2000"});
+    parser.addOption({"length", "Approximate answer length in characters", "L", "80"});
+    parser.addOption({"rounds", "Passes over all pairs per matcher", "R", "5"});
+    parser.addOption({"seed", "Random seed", "S", "1"});
+    parser.addOption({"variants", "Largest number of accepted spellings per answer", "V", "16"});
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    const int pairCount = qMax(1, parser.value("pairs").toInt());
+    const int length = qMax(1, parser.value("length").toInt());
+    const int rounds = qMax(1, parser.value("rounds").toInt());
+    QRandomGenerator generator(parser.value("seed").toUInt());
+
+    // Mostly near misses, plus some unrelated sentences of similar length
+    QStringList references;
+    QStringList answers;
+    for (int i = 0; i < pairCount; ++i) {
+        const QString reference = randomSentence(generator, length);
+        references.append(reference);
+        if (generator.bounded(5) == 0) {
+            answers.append(randomSentence(generator, length));
+        } else {
+            answers.append(withTypos(generator, reference, generator.bounded(5)));
+        }
+    }
+
+    const int limit = TranslateGrader::kMaxTypos;
+
+    QVector<AnswerPattern> patterns;
+    patterns.reserve(pairCount);
+    for (const QString& reference : references) {
+        patterns.append(AnswerPattern(reference));
+    }
+
+    // Correctness first: the bounded matchers must accept exactly the same pairs
+    int accepted = 0;
+    for (int i = 0; i < pairCount; ++i) {
+        const bool baseline = fullMatrixDistance(answers.at(i), references.at(i)) <= limit;
+        const bool bounded = TranslateGrader::boundedEditDistance(answers.at(i), references.at(i), limit) <= limit;
+        const bool bitParallel = patterns.at(i).boundedDistance(answers.at(i), limit) <= limit;
+        if (baseline != bounded || baseline != bitParallel) {
+            err << "grader_bench: mismatch on pair " << i << ": \"" << answers.at(i)
+                << "\" vs \"" << references.at(i) << "\"" << Qt::endl;
+            return 1;
+        }
+        accepted += bounded ? 1 : 0;
+    }
+
+    volatile int sink = 0;
+    const qint64 calls = qint64(pairCount) * rounds;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int round = 0; round < rounds; ++round) {
+        for (int i = 0; i < pairCount; ++i) {
+            sink = sink + (fullMatrixDistance(answers.at(i), references.at(i)) <= limit);
+        }
+    }
+    const qint64 baselineNs = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int round = 0; round < rounds; ++round) {
+        for (int i = 0; i < pairCount; ++i) {
+            sink = sink + (TranslateGrader::boundedEditDistance(answers.at(i), references.at(i), limit) <= limit);
+        }
+    }
+    const qint64 boundedNs = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int round = 0; round < rounds; ++round) {
+        for (int i = 0; i < pairCount; ++i) {
+            sink = sink + (patterns.at(i).boundedDistance(answers.at(i), limit) <= limit);
+        }
+    }
+    const qint64 bitParallelNs = timer.nsecsElapsed();
+
+    out << pairCount << " pairs of ~" << length << " characters, " << accepted
+        << " within " << limit << " edits, " << rounds << " rounds" << Qt::endl;
+    out << "full matrix:  " << double(baselineNs) / calls << " ns/call" << Qt::endl;
+    out << "banded:       " << double(boundedNs) / calls << " ns/call ("
+        << double(baselineNs) / qMax<qint64>(1, boundedNs) << "x)" << Qt::endl;
+    out << "bit-parallel: " << double(bitParallelNs) / calls << " ns/call ("
+        << double(baselineNs) / qMax<qint64>(1, bitParallelNs) << "x)" << Qt::endl;
+
+    // Several accepted spellings per answer: one pattern at a time versus one trie walk
+    const int maxVariants = qMax(1, parser.value("variants").toInt());
+    for (int variantCount = 1; variantCount <= maxVariants; variantCount *= 2) {
+        QVector<QVector<AnswerPattern>> variantPatterns;
+        QVector<AnswerTrie> tries;
+        variantPatterns.reserve(pairCount);
+        tries.reserve(pairCount);
+        for (int i = 0; i < pairCount; ++i) {
+            const QStringList variants = spellingVariants(generator, references.at(i), variantCount);
+            QVector<AnswerPattern> compiled;
+            for (const QString& variant : variants) {
+                compiled.append(AnswerPattern(variant));
+            }
+            variantPatterns.append(compiled);
+            tries.append(AnswerTrie(variants));
+        }
+
+        auto anyPattern = [&](int i) {
+            for (const AnswerPattern& pattern : variantPatterns.at(i)) {
+                if (pattern.boundedDistance(answers.at(i), limit) <= limit) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (int i = 0; i < pairCount; ++i) {
+            if (anyPattern(i) != tries.at(i).matches(answers.at(i), limit)) {
+                err << "grader_bench: trie mismatch on pair " << i << " with "
+                    << variantCount << " variants" << Qt::endl;
+                return 1;
+            }
+        }
+
+        timer.restart();
+        for (int round = 0; round < rounds; ++round) {
+            for (int i = 0; i < pairCount; ++i) {
+                sink = sink + anyPattern(i);
+            }
+        }
+        const qint64 perPatternNs = timer.nsecsElapsed();
+
+        timer.restart();
+        for (int round = 0; round < rounds; ++round) {
+            for (int i = 0; i < pairCount; ++i) {
+                sink = sink + tries.at(i).matches(answers.at(i), limit);
+            }
+        }
+        const qint64 trieNs = timer.nsecsElapsed();
+
+        out << variantCount << " variants: per pattern " << double(perPatternNs) / calls
+            << " ns/answer, trie " << double(trieNs) / calls << " ns/answer" << Qt::endl;
+    }
+    return 0;
+}
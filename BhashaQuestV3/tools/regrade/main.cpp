@@ -0,0 +1,287 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QVector>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <cstdio>
+#include "../../src/core/data/ContentRepository.h"
+#include "../../src/core/domain/GraderRegistry.h"
+
+/**
+ * regrade - Re-grade a recorded answer log with the current graders
+ *
+ * Usage: regrade <answers.tsv|-> [--content content.json] [--output FILE]
+ *                [--threads N] [--batch N] [--chunk N]
+ *
+ * Each log line is "exerciseId<TAB>answer<TAB>timestamp"; the timestamp is
+ * optional and not used for grading. Tabs, newlines and backslashes inside an
+ * answer are written as \t, \n and \\. Lines starting with '#' are skipped.
+ *
+ * The log is streamed in batches of --batch lines. Ids are resolved on the
+ * main thread, then each batch is cut into chunks of --chunk answers that the
+ * thread pool grades through GraderRegistry::gradeBatch(). Chunks are small
+ * and many, so idle threads keep picking up work until the batch is done.
+ *
+ * Output is one TSV row per exercise and per skill:
+ *   scope  id  skill  attempts  correct  accuracy  meanScore
+ * Unknown exercise ids and malformed lines are counted and reported on stderr.
+ */
+
+namespace {
+
+struct Tally {
+    qint64 attempts = 0;
+    qint64 correct = 0;
+    qint64 scoreSum = 0;
+
+    void add(const Tally& other) {
+        attempts += other.attempts;
+        correct += other.correct;
+        scoreSum += other.scoreSum;
+    }
+};
+
+struct Chunk {
+    int first;
+    int count;
+};
+
+QString unescapeField(const QString& field) {
+    if (!field.contains(QLatin1Char('\\'))) {
+        return field;
+    }
+
+    QString result;
+    result.reserve(field.length());
+    for (int i = 0; i < field.length(); ++i) {
+        const QChar c = field.at(i);
+        if (c != QLatin1Char('\\') || i + 1 == field.length()) {
+            result += c;
+            continue;
+        }
+        const QChar next = field.at(++i);
+        if (next == QLatin1Char('t')) {
+            result += QLatin1Char('\t');
+        } else if (next == QLatin1Char('n')) {
+            result += QLatin1Char('\n');
+        } else {
+            result += next;
+        }
+    }
+    return result;
+}
+
+// Split "id<TAB>answer[<TAB>timestamp]"; the answer is everything in between
+bool parseLine(const QString& line, QString* exerciseId, QString* answer) {
+    const int firstTab = line.indexOf(QLatin1Char('\t'));
+    if (firstTab <= 0) {
+        return false;
+    }
+    const int lastTab = line.lastIndexOf(QLatin1Char('\t'));
+    const int answerEnd = (lastTab > firstTab) ? lastTab : line.length();
+
+    *exerciseId = line.left(firstTab);
+    *answer = unescapeField(line.mid(firstTab + 1, answerEnd - firstTab - 1));
+    return true;
+}
+
+void writeRow(QTextStream& out, const char* scope, const QString& id, const QString& skillId,
+              const Tally& tally) {
+    const double accuracy = tally.attempts > 0 ? double(tally.correct) / tally.attempts : 0.0;
+    const double meanScore = tally.attempts > 0 ? double(tally.scoreSum) / tally.attempts : 0.0;
+    out << scope << '\t' << id << '\t' << skillId << '\t' << tally.attempts << '\t'
+        << tally.correct << '\t' << QString::number(accuracy, 'f', 4) << '\t'
+        << QString::number(meanScore, 'f', 2) << '\n';
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("regrade");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Re-grade a recorded answer log and report accuracy per exercise and skill");
+    parser.addHelpOption();
+    parser.addPositionalArgument("log", "Answer log (TSV: exerciseId, answer, timestamp), or - for stdin");
+    parser.addOption({"content", "Content file to grade against", "path", "content.json"});
+    parser.addOption({"output", "Write the report here instead of stdout", "path"});
+    parser.addOption({"threads", "Grading threads (default: one per core)", "N", "0"});
+    parser.addOption({"batch", "Log lines read per batch", "N", "65536"});
+    parser.addOption({"chunk", "Answers per work item", "N", "256"});
+    parser.process(app);
+
+    QTextStream err(stderr);
+
+    const QStringList args = parser.positionalArguments();
+    if (args.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    const int threads = parser.value("threads").toInt();
+    const int batchSize = std::max(1, parser.value("batch").toInt());
+    const int chunkSize = std::max(1, parser.value("chunk").toInt());
+
+    // Build every skill up front: workers only read exercises, never materialize them
+    ContentRepository repository(parser.value("content"));
+    repository.setPreloadAllSkills(true);
+    if (!repository.loadContent()) {
+        err << "regrade: cannot load content from " << parser.value("content") << Qt::endl;
+        return 1;
+    }
+
+    QFile logFile;
+    const QString logPath = args.at(0);
+    bool opened;
+    if (logPath == "-") {
+        opened = logFile.open(stdin, QIODevice::ReadOnly | QIODevice::Text);
+    } else {
+        logFile.setFileName(logPath);
+        opened = logFile.open(QIODevice::ReadOnly | QIODevice::Text);
+    }
+    if (!opened) {
+        err << "regrade: cannot open " << logPath << ": " << logFile.errorString() << Qt::endl;
+        return 1;
+    }
+
+    QThreadPool pool;
+    if (threads > 0) {
+        pool.setMaxThreadCount(threads);
+    }
+
+    // Tallies are indexed by interned exercise id, so workers never touch a hash
+    QVector<Tally> tallies(repository.getSnapshot()->exerciseEntries.size());
+    QHash<QString, qint64> unknownIds;
+    qint64 malformedLines = 0;
+    qint64 lineNumber = 0;
+
+    QVector<GradeRequest> requests;
+    QVector<int> exerciseIndices;
+    QVector<GradeOutcome> outcomes;
+    QVector<Chunk> chunks;
+    requests.reserve(batchSize);
+    exerciseIndices.reserve(batchSize);
+
+    const GraderRegistry& registry = GraderRegistry::getInstance();
+    QElapsedTimer timer;
+    timer.start();
+
+    QTextStream in(&logFile);
+    in.setEncoding(QStringConverter::Utf8);
+    bool atEnd = false;
+
+    while (!atEnd) {
+        // ========== Read and resolve one batch ==========
+        requests.clear();
+        exerciseIndices.clear();
+        QString line;
+        QString exerciseId;
+        QString answer;
+
+        while (requests.size() < batchSize) {
+            if (!in.readLineInto(&line)) {
+                atEnd = true;
+                break;
+            }
+            ++lineNumber;
+            if (line.isEmpty() || line.startsWith(QLatin1Char('#'))) {
+                continue;
+            }
+            if (!parseLine(line, &exerciseId, &answer)) {
+                if (malformedLines++ < 10) {
+                    err << "regrade: line " << lineNumber << ": expected exerciseId<TAB>answer" << Qt::endl;
+                }
+                continue;
+            }
+
+            const int index = repository.getExerciseIndex(exerciseId);
+            Exercise* exercise = repository.getExerciseByIndex(index);
+            if (!exercise) {
+                ++unknownIds[exerciseId];
+                continue;
+            }
+            requests.append(GradeRequest{exercise, answer});
+            exerciseIndices.append(index);
+        }
+
+        if (requests.isEmpty()) {
+            continue;
+        }
+
+        // ========== Grade the batch on the pool ==========
+        outcomes.resize(requests.size());
+        chunks.clear();
+        for (int first = 0; first < requests.size(); first += chunkSize) {
+            chunks.append(Chunk{first, std::min(chunkSize, static_cast<int>(requests.size()) - first)});
+        }
+
+        const GradeRequest* requestData = requests.constData();
+        GradeOutcome* outcomeData = outcomes.data();
+        QtConcurrent::blockingMap(&pool, chunks, [&registry, requestData, outcomeData](const Chunk& chunk) {
+            registry.gradeBatch(requestData + chunk.first, chunk.count, outcomeData + chunk.first);
+        });
+
+        for (int i = 0; i < requests.size(); ++i) {
+            Tally& tally = tallies[exerciseIndices.at(i)];
+            ++tally.attempts;
+            tally.correct += outcomes.at(i).isCorrect() ? 1 : 0;
+            tally.scoreSum += outcomes.at(i).score;
+        }
+    }
+
+    const double elapsedMs = timer.nsecsElapsed() / 1e6;
+
+    // ========== Report ==========
+    QFile outputFile;
+    if (parser.isSet("output")) {
+        outputFile.setFileName(parser.value("output"));
+        if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+            err << "regrade: cannot write " << outputFile.fileName() << ": "
+                << outputFile.errorString() << Qt::endl;
+            return 1;
+        }
+    } else {
+        outputFile.open(stdout, QIODevice::WriteOnly | QIODevice::Text);
+    }
+    QTextStream out(&outputFile);
+    out << "scope\tid\tskill\tattempts\tcorrect\taccuracy\tmeanScore\n";
+
+    qint64 graded = 0;
+    for (const QString& skillId : repository.getAvailableSkills()) {
+        Tally skillTally;
+        for (Exercise* exercise : repository.getExercisesForSkill(skillId)) {
+            const int index = repository.getExerciseIndex(exercise->getId());
+            if (index < 0 || tallies.at(index).attempts == 0) {
+                continue;
+            }
+            writeRow(out, "exercise", exercise->getId(), skillId, tallies.at(index));
+            skillTally.add(tallies.at(index));
+        }
+        if (skillTally.attempts > 0) {
+            writeRow(out, "skill", skillId, skillId, skillTally);
+            graded += skillTally.attempts;
+        }
+    }
+    out.flush();
+
+    qint64 unknownAnswers = 0;
+    for (auto it = unknownIds.cbegin(); it != unknownIds.cend(); ++it) {
+        unknownAnswers += it.value();
+    }
+    if (!unknownIds.isEmpty()) {
+        err << "regrade: skipped " << unknownAnswers << " answers to " << unknownIds.size()
+            << " unknown exercise ids" << Qt::endl;
+    }
+    if (malformedLines > 0) {
+        err << "regrade: skipped " << malformedLines << " malformed lines" << Qt::endl;
+    }
+    err << "regrade: graded " << graded << " answers in " << QString::number(elapsedMs, 'f', 1)
+        << " ms on " << pool.maxThreadCount() << " threads" << Qt::endl;
+    return 0;
+}
@@ -0,0 +1,552 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDate>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QVector>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "../../src/core/domain/SchedulingEngine.h"
+#include "../../src/core/domain/FSRSEngine.h"
+#include "../../src/core/domain/SM2Engine.h"
+
+/**
+ * srs_optimizer - Fit scheduling engine parameters to a review log
+ *
+ * Usage: srs_optimizer <reviews.tsv|-> [--engine fsrs|sm2] [--output FILE]
+ *                      [--per-learner DIR] [--min-reviews N]
+ *                      [--iterations N] [--threads N]
+ *
+ * Each log line is "learnerId<TAB>exerciseId<TAB>yyyy-MM-dd<TAB>grade", with
+ * grade 1-4 (or again/hard/good/easy). Lines starting with '#' are skipped.
+ * One learner's reviews of one exercise form a card; a card's reviews are
+ * replayed through the engine in date order, and every review after the first
+ * is scored by the log-loss of the engine's predicted recall probability
+ * against whether the grade was a pass (anything but Again).
+ *
+ * The log is held as columns (day, grade) sorted by learner and card, with
+ * offset arrays marking where each card and learner starts. A loss
+ * evaluation streams through those arrays without touching a string.
+ *
+ * Parameters are fitted with Adam on central-difference gradients, in
+ * coordinates scaled to each parameter's allowed range. Each step scores one
+ * of kMiniBatches interleaved subsets of the cards. Its 2P + 1 loss
+ * evaluations are cut into (parameter set, card range) work items that run
+ * on the thread pool together. Per-learner fits start from the
+ * global fit and run one learner per thread.
+ *
+ * Output is the JSON SRSScheduler::loadEngineParameters() reads, plus the
+ * number of scored reviews and the final log-loss.
+ */
+
+namespace {
+
+const int kCardsPerChunk = 256;
+const int kMiniBatches = 8;             // Each step scores every 8th chunk of cards
+const double kGradientStep = 1e-3;      // In range-scaled coordinates
+const double kLearningRate = 0.02;
+const double kMinimumProbability = 1e-6;
+
+struct Range {
+    double lower;
+    double upper;
+};
+
+// Allowed range of every parameter, in SchedulingEngine::parameters() order
+const Range kFsrsRanges[FSRSEngine::kParameterCount] = {
+    {0.1, 100.0}, {0.1, 100.0}, {0.1, 100.0}, {0.1, 100.0},    // Initial stability per grade
+    {1.0, 10.0}, {0.1, 5.0}, {0.1, 5.0}, {0.0, 0.75},           // Difficulty
+    {0.0, 4.0}, {0.0, 0.8}, {0.01, 3.0},                        // Stability after success
+    {0.5, 5.0}, {0.01, 0.2}, {0.01, 0.9}, {0.01, 2.0},          // Stability after lapse
+    {0.0, 1.0}, {1.0, 6.0},                                     // Hard penalty, easy bonus
+    {0.9, 0.9}                                                  // Desired retention: not fitted
+};
+
+// Intervals are whole days, so the first/second interval only move in coarse steps
+const Range kSm2Ranges[SM2Engine::kParameterCount] = {
+    {1.3, 5.0}, {1.1, 2.5}, {1.0, 10.0}, {1.0, 30.0}
+};
+
+/**
+ * ReviewColumns - The review log sorted by learner, card and day
+ */
+struct ReviewColumns {
+    QVector<qint32> day;            // Julian day of each review
+    QVector<quint8> grade;          // ReviewGrade value of each review
+    QVector<int> cardStart;         // Card c owns reviews [cardStart[c], cardStart[c + 1])
+    QVector<int> learnerStart;      // Learner l owns cards [learnerStart[l], learnerStart[l + 1])
+    QStringList learnerIds;
+
+    int cardCount() const { return cardStart.size() - 1; }
+};
+
+struct LossSum {
+    double loss = 0.0;
+    qint64 count = 0;
+};
+
+struct WorkItem {
+    int slot;                       // Where the partial sum goes
+    int variant;                    // Which parameter set
+    int firstCard;
+    int lastCard;                   // Exclusive
+};
+
+int parseGrade(const QString& text) {
+    bool isNumber = false;
+    const int value = text.toInt(&isNumber);
+    if (isNumber) {
+        return (value >= 1 && value <= 4) ? value : 0;
+    }
+    const QString name = text.toLower();
+    if (name == "again") return 1;
+    if (name == "hard") return 2;
+    if (name == "good") return 3;
+    if (name == "easy") return 4;
+    return 0;
+}
+
+bool readReviews(QTextStream& in, ReviewColumns* columns, QTextStream& err) {
+    // Raw rows in file order; card ids are interned per learner + exercise
+    QVector<int> rowCard;
+    QVector<qint32> rowDay;
+    QVector<quint8> rowGrade;
+    QVector<int> cardLearner;
+    QHash<QString, int> learnerIndex;
+    QHash<QString, int> cardIndex;
+    qint64 malformedLines = 0;
+    qint64 lineNumber = 0;
+
+    QString line;
+    while (in.readLineInto(&line)) {
+        ++lineNumber;
+        if (line.isEmpty() || line.startsWith(QLatin1Char('#'))) {
+            continue;
+        }
+
+        const QStringList fields = line.split(QLatin1Char('\t'));
+        const QDate date = fields.size() == 4 ? QDate::fromString(fields.at(2), Qt::ISODate) : QDate();
+        const int grade = fields.size() == 4 ? parseGrade(fields.at(3).trimmed()) : 0;
+        if (!date.isValid() || grade == 0 || fields.at(0).isEmpty() || fields.at(1).isEmpty()) {
+            if (malformedLines++ < 10) {
+                err << "srs_optimizer: line " << lineNumber
+                    << ": expected learnerId<TAB>exerciseId<TAB>yyyy-MM-dd<TAB>grade" << Qt::endl;
+            }
+            continue;
+        }
+
+        auto learner = learnerIndex.find(fields.at(0));
+        if (learner == learnerIndex.end()) {
+            learner = learnerIndex.insert(fields.at(0), learnerIndex.size());
+            columns->learnerIds.append(fields.at(0));
+        }
+        const QString cardKey = fields.at(0) + QLatin1Char('\t') + fields.at(1);
+        auto card = cardIndex.find(cardKey);
+        if (card == cardIndex.end()) {
+            card = cardIndex.insert(cardKey, cardIndex.size());
+            cardLearner.append(learner.value());
+        }
+
+        rowCard.append(card.value());
+        rowDay.append(static_cast<qint32>(date.toJulianDay()));
+        rowGrade.append(static_cast<quint8>(grade));
+    }
+
+    if (malformedLines > 0) {
+        err << "srs_optimizer: skipped " << malformedLines << " malformed lines" << Qt::endl;
+    }
+    if (rowCard.isEmpty()) {
+        return false;
+    }
+
+    // Cards grouped by learner, reviews by card and day; ties keep file order
+    QVector<int> cardOrder(cardLearner.size());
+    std::iota(cardOrder.begin(), cardOrder.end(), 0);
+    std::stable_sort(cardOrder.begin(), cardOrder.end(), [&cardLearner](int a, int b) {
+        return cardLearner[a] < cardLearner[b];
+    });
+    QVector<int> cardRank(cardOrder.size());
+    for (int rank = 0; rank < cardOrder.size(); ++rank) {
+        cardRank[cardOrder[rank]] = rank;
+    }
+
+    QVector<int> rowOrder(rowCard.size());
+    std::iota(rowOrder.begin(), rowOrder.end(), 0);
+    std::stable_sort(rowOrder.begin(), rowOrder.end(), [&](int a, int b) {
+        if (rowCard[a] != rowCard[b]) {
+            return cardRank[rowCard[a]] < cardRank[rowCard[b]];
+        }
+        return rowDay[a] < rowDay[b];
+    });
+
+    columns->day.reserve(rowOrder.size());
+    columns->grade.reserve(rowOrder.size());
+    columns->cardStart.reserve(cardOrder.size() + 1);
+    columns->learnerStart.reserve(columns->learnerIds.size() + 1);
+
+    int previousCard = -1;
+    int previousLearner = -1;
+    for (int row : rowOrder) {
+        const int card = rowCard[row];
+        if (card != previousCard) {
+            const int learner = cardLearner[card];
+            while (previousLearner < learner) {
+                columns->learnerStart.append(columns->cardStart.size());
+                ++previousLearner;
+            }
+            columns->cardStart.append(columns->day.size());
+            previousCard = card;
+        }
+        columns->day.append(rowDay[row]);
+        columns->grade.append(rowGrade[row]);
+    }
+    columns->cardStart.append(columns->day.size());
+    columns->learnerStart.append(columns->cardCount());
+    return true;
+}
+
+// Log-loss of the engine's recall predictions over cards [firstCard, lastCard)
+LossSum evaluateCards(const SchedulingEngine& engine, const ReviewColumns& columns,
+                      int firstCard, int lastCard) {
+    LossSum sum;
+    MemoryStateTable state;
+    const int row = state.append();
+    const qint32* day = columns.day.constData();
+    const quint8* grade = columns.grade.constData();
+
+    for (int card = firstCard; card < lastCard; ++card) {
+        state.stability[row] = 0.0f;
+        state.difficulty[row] = 0.0f;
+        state.reviewCount[row] = 0;
+
+        for (int i = columns.cardStart[card]; i < columns.cardStart[card + 1]; ++i) {
+            if (state.stability[row] > 0.0f) {
+                double p = engine.recallProbability(state.stability[row], day[i] - state.lastReviewDay[row]);
+                p = std::min(std::max(p, kMinimumProbability), 1.0 - kMinimumProbability);
+                const bool recalled = grade[i] != static_cast<quint8>(ReviewGrade::Again);
+                sum.loss -= recalled ? std::log(p) : std::log(1.0 - p);
+                ++sum.count;
+            }
+            engine.review(state, row, static_cast<ReviewGrade>(grade[i]), day[i]);
+        }
+    }
+    return sum;
+}
+
+/**
+ * Fits one parameter vector to cards [firstCard, lastCard)
+ * With a pool, each step's evaluations run on it; without, they run on the calling thread.
+ */
+class Fitter {
+public:
+    Fitter(const QString& engineName, const QVector<Range>& ranges, const ReviewColumns& columns,
+           QThreadPool* pool)
+        : engineName(engineName), ranges(ranges), columns(columns), pool(pool) {}
+
+    QVector<double> fit(const QVector<double>& start, int firstCard, int lastCard, int iterations,
+                        LossSum* finalLoss) const {
+        const int parameterCount = ranges.size();
+        QVector<int> fitted;
+        for (int i = 0; i < parameterCount; ++i) {
+            if (ranges[i].upper > ranges[i].lower) {
+                fitted.append(i);
+            }
+        }
+
+        QVector<double> x(parameterCount);
+        for (int i = 0; i < parameterCount; ++i) {
+            x[i] = toScaled(i, start[i]);
+        }
+
+        // Adam state
+        QVector<double> m(parameterCount, 0.0);
+        QVector<double> v(parameterCount, 0.0);
+        const double beta1 = 0.9;
+        const double beta2 = 0.999;
+
+        // Mini-batches only pay off once every batch still covers many cards
+        const int chunkCount = (lastCard - firstCard + kCardsPerChunk - 1) / kCardsPerChunk;
+        const int batches = chunkCount >= 4 * kMiniBatches ? kMiniBatches : 1;
+
+        QVector<QVector<double>> variants(2 * fitted.size() + 1);
+        QVector<LossSum> losses;
+
+        for (int step = 1; step <= iterations; ++step) {
+            // Variant 0 is x itself, then x +/- h along each fitted coordinate
+            variants[0] = x;
+            for (int k = 0; k < fitted.size(); ++k) {
+                variants[2 * k + 1] = x;
+                variants[2 * k + 2] = x;
+                variants[2 * k + 1][fitted[k]] += kGradientStep;
+                variants[2 * k + 2][fitted[k]] -= kGradientStep;
+            }
+            losses = evaluate(variants, firstCard, lastCard, (step - 1) % batches, batches);
+            if (losses[0].count == 0) {
+                continue;
+            }
+
+            for (int k = 0; k < fitted.size(); ++k) {
+                const int i = fitted[k];
+                const double gradient = (losses[2 * k + 1].loss - losses[2 * k + 2].loss)
+                    / (2.0 * kGradientStep * losses[0].count);
+                m[i] = beta1 * m[i] + (1.0 - beta1) * gradient;
+                v[i] = beta2 * v[i] + (1.0 - beta2) * gradient * gradient;
+                const double mHat = m[i] / (1.0 - std::pow(beta1, step));
+                const double vHat = v[i] / (1.0 - std::pow(beta2, step));
+                // Keep x +/- h inside the range
+                x[i] = std::min(std::max(x[i] - kLearningRate * mHat / (std::sqrt(vHat) + 1e-8),
+                                         kGradientStep), 1.0 - kGradientStep);
+            }
+        }
+
+        *finalLoss = evaluate(QVector<QVector<double>>{x}, firstCard, lastCard, 0, 1).at(0);
+        return toParameters(x);
+    }
+
+private:
+    QVector<double> toParameters(const QVector<double>& scaled) const {
+        QVector<double> parameters(scaled.size());
+        for (int i = 0; i < scaled.size(); ++i) {
+            parameters[i] = fromScaled(i, scaled[i]);
+        }
+        return parameters;
+    }
+
+    double toScaled(int i, double value) const {
+        const double width = ranges[i].upper - ranges[i].lower;
+        return width > 0.0 ? std::min(std::max((value - ranges[i].lower) / width, 0.0), 1.0) : 0.0;
+    }
+
+    double fromScaled(int i, double scaled) const {
+        return ranges[i].lower + scaled * (ranges[i].upper - ranges[i].lower);
+    }
+
+    // Loss of each parameter set over the card chunks in mini-batch batch of batches
+    QVector<LossSum> evaluate(const QVector<QVector<double>>& variants, int firstCard, int lastCard,
+                              int batch, int batches) const {
+        QVector<QSharedPointer<const SchedulingEngine>> engines;
+        for (const QVector<double>& scaled : variants) {
+            engines.append(SchedulingEngine::create(engineName, toParameters(scaled)));
+        }
+
+        QVector<WorkItem> items;
+        for (int variant = 0; variant < variants.size(); ++variant) {
+            const int batchStart = firstCard + batch * kCardsPerChunk;
+            for (int first = batchStart; first < lastCard; first += batches * kCardsPerChunk) {
+                items.append(WorkItem{static_cast<int>(items.size()), variant, first,
+                                      std::min(first + kCardsPerChunk, lastCard)});
+            }
+        }
+
+        // Partial sums per work item, added up in a fixed order so results do not depend on scheduling
+        QVector<LossSum> partial(items.size());
+        LossSum* partialData = partial.data();
+        auto run = [this, &engines, partialData](const WorkItem& item) {
+            partialData[item.slot] = evaluateCards(*engines[item.variant], columns, item.firstCard, item.lastCard);
+        };
+        if (pool) {
+            QtConcurrent::blockingMap(pool, items, run);
+        } else {
+            std::for_each(items.cbegin(), items.cend(), run);
+        }
+
+        QVector<LossSum> totals(variants.size());
+        for (const WorkItem& item : items) {
+            totals[item.variant].loss += partial[item.slot].loss;
+            totals[item.variant].count += partial[item.slot].count;
+        }
+        return totals;
+    }
+
+    QString engineName;
+    QVector<Range> ranges;
+    const ReviewColumns& columns;
+    QThreadPool* pool;
+};
+
+bool writeParameters(const QString& path, const QVector<double>& parameters, const QString& engineName,
+                     const QString& learnerId, const LossSum& loss, QString* errorMessage) {
+    QJsonObject json = SchedulingEngine::create(engineName, parameters)->toJson();
+    if (!learnerId.isEmpty()) {
+        json["learner"] = learnerId;
+    }
+    json["reviews"] = static_cast<double>(loss.count);
+    json["logLoss"] = loss.count > 0 ? loss.loss / loss.count : 0.0;
+
+    QSaveFile output(path);
+    if (!output.open(QIODevice::WriteOnly)) {
+        *errorMessage = QString("Cannot write %1").arg(path);
+        return false;
+    }
+    output.write(QJsonDocument(json).toJson());
+    if (!output.commit()) {
+        *errorMessage = QString("Failed to save %1").arg(path);
+        return false;
+    }
+    return true;
+}
+
+QString safeFileName(const QString& learnerId) {
+    QString name = learnerId;
+    for (QChar& c : name) {
+        if (!c.isLetterOrNumber() && c != QLatin1Char('-') && c != QLatin1Char('_')) {
+            c = QLatin1Char('_');
+        }
+    }
+    return name + ".json";
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("srs_optimizer");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Fit spaced repetition parameters to a review log by minimizing log-loss");
+    parser.addHelpOption();
+    parser.addPositionalArgument("log", "Review log (TSV: learnerId, exerciseId, date, grade), or - for stdin");
+    parser.addOption({"engine", "Scheduling engine to fit (fsrs or sm2)", "name", "fsrs"});
+    parser.addOption({"output", "Global parameter file", "path", "srs_parameters.json"});
+    parser.addOption({"per-learner", "Also fit each learner and write DIR/<learner>.json", "dir"});
+    parser.addOption({"min-reviews", "Skip per-learner fits with fewer scored reviews", "N", "500"});
+    parser.addOption({"iterations", "Optimizer steps per fit", "N", "100"});
+    parser.addOption({"threads", "Worker threads (default: one per core)", "N", "0"});
+    parser.process(app);
+
+    QTextStream err(stderr);
+
+    const QStringList args = parser.positionalArguments();
+    if (args.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    const QString engineName = parser.value("engine");
+    QString error;
+    auto defaults = SchedulingEngine::create(engineName, QVector<double>(), &error);
+    if (!defaults) {
+        err << "srs_optimizer: " << error << Qt::endl;
+        return 1;
+    }
+    const QVector<Range> ranges = engineName == "fsrs"
+        ? QVector<Range>(kFsrsRanges, kFsrsRanges + FSRSEngine::kParameterCount)
+        : QVector<Range>(kSm2Ranges, kSm2Ranges + SM2Engine::kParameterCount);
+
+    const int iterations = std::max(0, parser.value("iterations").toInt());
+    const int minReviews = std::max(1, parser.value("min-reviews").toInt());
+    const int threads = parser.value("threads").toInt();
+
+    QThreadPool pool;
+    if (threads > 0) {
+        pool.setMaxThreadCount(threads);
+    }
+
+    // ========== Load ==========
+    QFile logFile;
+    const QString logPath = args.at(0);
+    bool opened;
+    if (logPath == "-") {
+        opened = logFile.open(stdin, QIODevice::ReadOnly | QIODevice::Text);
+    } else {
+        logFile.setFileName(logPath);
+        opened = logFile.open(QIODevice::ReadOnly | QIODevice::Text);
+    }
+    if (!opened) {
+        err << "srs_optimizer: cannot open " << logPath << ": " << logFile.errorString() << Qt::endl;
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QTextStream in(&logFile);
+    in.setEncoding(QStringConverter::Utf8);
+    ReviewColumns columns;
+    if (!readReviews(in, &columns, err)) {
+        err << "srs_optimizer: no reviews in " << logPath << Qt::endl;
+        return 1;
+    }
+    err << "srs_optimizer: " << columns.day.size() << " reviews, " << columns.cardCount() << " cards, "
+        << columns.learnerIds.size() << " learners (" << timer.restart() << " ms)" << Qt::endl;
+
+    // ========== Global Fit ==========
+    const Fitter globalFitter(engineName, ranges, columns, &pool);
+    LossSum initialLoss;
+    globalFitter.fit(defaults->parameters(), 0, columns.cardCount(), 0, &initialLoss);
+
+    LossSum globalLoss;
+    const QVector<double> global = globalFitter.fit(defaults->parameters(), 0, columns.cardCount(),
+                                                    iterations, &globalLoss);
+    if (globalLoss.count == 0) {
+        err << "srs_optimizer: no card was reviewed twice; nothing to fit" << Qt::endl;
+        return 1;
+    }
+    err << "srs_optimizer: log-loss " << QString::number(initialLoss.loss / initialLoss.count, 'f', 5)
+        << " -> " << QString::number(globalLoss.loss / globalLoss.count, 'f', 5) << " over "
+        << globalLoss.count << " reviews (" << timer.restart() << " ms on " << pool.maxThreadCount()
+        << " threads)" << Qt::endl;
+
+    if (!writeParameters(parser.value("output"), global, engineName, QString(), globalLoss, &error)) {
+        err << "srs_optimizer: " << error << Qt::endl;
+        return 1;
+    }
+
+    // ========== Per-Learner Fits ==========
+    if (parser.isSet("per-learner")) {
+        const QString directory = parser.value("per-learner");
+        if (!QDir().mkpath(directory)) {
+            err << "srs_optimizer: cannot create " << directory << Qt::endl;
+            return 1;
+        }
+
+        // Learners are small: fit one per thread, each evaluating serially
+        const Fitter learnerFitter(engineName, ranges, columns, nullptr);
+        QVector<int> learners(columns.learnerIds.size());
+        std::iota(learners.begin(), learners.end(), 0);
+        QVector<LossSum> learnerLosses(learners.size());
+        QVector<QVector<double>> learnerParameters(learners.size());
+        LossSum* lossData = learnerLosses.data();
+        QVector<double>* parameterData = learnerParameters.data();
+
+        QtConcurrent::blockingMap(&pool, learners, [&](int learner) {
+            const int first = columns.learnerStart[learner];
+            const int last = columns.learnerStart[learner + 1];
+            LossSum scored;
+            learnerFitter.fit(global, first, last, 0, &scored);
+            if (scored.count < minReviews) {
+                lossData[learner] = scored;
+                return;
+            }
+            parameterData[learner] = learnerFitter.fit(global, first, last, iterations, &lossData[learner]);
+        });
+
+        int written = 0;
+        for (int learner = 0; learner < learners.size(); ++learner) {
+            if (learnerParameters[learner].isEmpty()) {
+                continue;
+            }
+            const QString path = QDir(directory).filePath(safeFileName(columns.learnerIds[learner]));
+            if (!writeParameters(path, learnerParameters[learner], engineName, columns.learnerIds[learner],
+                                 learnerLosses[learner], &error)) {
+                err << "srs_optimizer: " << error << Qt::endl;
+                return 1;
+            }
+            ++written;
+        }
+        err << "srs_optimizer: fitted " << written << " of " << learners.size() << " learners ("
+            << timer.restart() << " ms); the rest have fewer than " << minReviews
+            << " scored reviews" << Qt::endl;
+    }
+
+    return 0;
+}
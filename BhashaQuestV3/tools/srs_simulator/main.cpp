@@ -0,0 +1,257 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QVector>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include "../../src/core/domain/Clock.h"
+#include "../../src/core/domain/SRSScheduler.h"
+
+/**
+ * srs_simulator - Replay synthetic learners through SRSScheduler on a simulated clock
+ *
+ * Usage: srs_simulator [--items N] [--learners N] [--days N] [--new-per-day N]
+ *                      [--accuracy P] [--easy P] [--hard P]
+ *                      [--engine sm2|fsrs] [--scheduler-params FILE]
+ *                      [--threads N] [--seed N] [--output FILE]
+ *
+ * Every learner owns one SRSScheduler and items / learners exercises. Each
+ * simulated day a learner works through its review queue, then learns up to
+ * --new-per-day new exercises until it has seen all of them. Every review is
+ * answered correctly with probability --accuracy; a correct answer is graded
+ * Easy with probability --easy, Hard with probability --hard and Good
+ * otherwise, and a wrong answer is graded Again.
+ *
+ * All schedulers share one Clock. Learners are independent, so a day runs them
+ * in parallel on the pool; the clock only moves between days.
+ *
+ * Output is one TSV row per day:
+ *   day  date  newItems  reviews  lapses  schedulerMs
+ * where schedulerMs is the thread time spent inside SRSScheduler (queue
+ * building and scheduling), summed over learners. A summary goes to stderr.
+ */
+
+namespace {
+
+struct DayStats {
+    qint64 newItems = 0;
+    qint64 reviews = 0;
+    qint64 lapses = 0;
+    qint64 schedulerNs = 0;
+
+    void add(const DayStats& other) {
+        newItems += other.newItems;
+        reviews += other.reviews;
+        lapses += other.lapses;
+        schedulerNs += other.schedulerNs;
+    }
+};
+
+struct AnswerModel {
+    double accuracy;
+    double easyShare;
+    double hardShare;
+};
+
+/**
+ * Learner - One synthetic learner and its scheduler
+ */
+struct Learner {
+    Learner(int index, int itemCount, QSharedPointer<Clock> clock, quint32 seed)
+        : prefix(QString("L%1-").arg(index)), itemCount(itemCount), introduced(0),
+          scheduler(clock), random(seed) {}
+
+    ReviewGrade answer(const AnswerModel& model) {
+        if (random.generateDouble() >= model.accuracy) {
+            return ReviewGrade::Again;
+        }
+        const double rating = random.generateDouble();
+        if (rating < model.easyShare) {
+            return ReviewGrade::Easy;
+        }
+        if (rating < model.easyShare + model.hardShare) {
+            return ReviewGrade::Hard;
+        }
+        return ReviewGrade::Good;
+    }
+
+    void simulateDay(const AnswerModel& model, int newPerDay) {
+        today = DayStats();
+
+        // Grades are drawn up front so the timer only covers scheduler work
+        QElapsedTimer timer;
+        timer.start();
+        const QList<QString> queue = scheduler.getReviewQueue();
+        today.schedulerNs += timer.nsecsElapsed();
+
+        grades.resize(queue.size());
+        for (ReviewGrade& grade : grades) {
+            grade = answer(model);
+            today.lapses += grade == ReviewGrade::Again ? 1 : 0;
+        }
+        today.reviews = queue.size();
+
+        timer.restart();
+        for (int i = 0; i < queue.size(); ++i) {
+            scheduler.scheduleNextReview(queue.at(i), grades.at(i));
+        }
+        today.schedulerNs += timer.nsecsElapsed();
+
+        // New exercises are learned after the reviews, as in a lesson
+        const int learnCount = std::min(newPerDay, itemCount - introduced);
+        newIds.clear();
+        grades.resize(learnCount);
+        for (int i = 0; i < learnCount; ++i) {
+            newIds.append(prefix + QString::number(introduced + i));
+            grades[i] = answer(model);
+        }
+        introduced += learnCount;
+        today.newItems = learnCount;
+
+        timer.restart();
+        for (int i = 0; i < learnCount; ++i) {
+            scheduler.recordCompletion(newIds.at(i));
+            scheduler.scheduleNextReview(newIds.at(i), grades.at(i));
+        }
+        today.schedulerNs += timer.nsecsElapsed();
+    }
+
+    QString prefix;
+    int itemCount;
+    int introduced;
+    SRSScheduler scheduler;
+    QRandomGenerator random;
+    DayStats today;
+    QVector<ReviewGrade> grades;
+    QStringList newIds;
+};
+
+double probabilityOption(const QCommandLineParser& parser, const QString& name) {
+    return std::min(std::max(parser.value(name).toDouble(), 0.0), 1.0);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("srs_simulator");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Simulate learners reviewing with SRSScheduler to measure daily load and scheduler cost");
+    parser.addHelpOption();
+    parser.addOption({"items", "Exercises across all learners", "N", "1000000"});
+    parser.addOption({"learners", "Synthetic learners", "N", "100"});
+    parser.addOption({"days", "Simulated days", "N", "730"});
+    parser.addOption({"new-per-day", "New exercises each learner learns per day", "N", "20"});
+    parser.addOption({"accuracy", "Probability a review is answered correctly", "P", "0.85"});
+    parser.addOption({"easy", "Share of correct answers graded Easy", "P", "0.15"});
+    parser.addOption({"hard", "Share of correct answers graded Hard", "P", "0.15"});
+    parser.addOption({"engine", "Scheduling engine (sm2 or fsrs)", "name", "sm2"});
+    parser.addOption({"scheduler-params", "Engine parameters written by srs_optimizer", "path"});
+    parser.addOption({"threads", "Worker threads (default: one per core)", "N", "0"});
+    parser.addOption({"seed", "Random seed", "N", "1"});
+    parser.addOption({"output", "Write the daily report here instead of stdout", "path"});
+    parser.process(app);
+
+    QTextStream err(stderr);
+
+    const int learnerCount = std::max(1, parser.value("learners").toInt());
+    const int itemCount = std::max(0, parser.value("items").toInt());
+    const int days = std::max(0, parser.value("days").toInt());
+    const int newPerDay = std::max(0, parser.value("new-per-day").toInt());
+    const int threads = parser.value("threads").toInt();
+    const quint32 seed = parser.value("seed").toUInt();
+    const AnswerModel model{probabilityOption(parser, "accuracy"), probabilityOption(parser, "easy"),
+                            probabilityOption(parser, "hard")};
+
+    QString error;
+    QSharedPointer<const SchedulingEngine> engine = parser.isSet("scheduler-params")
+        ? SchedulingEngine::load(parser.value("scheduler-params"), &error)
+        : SchedulingEngine::create(parser.value("engine"), QVector<double>(), &error);
+    if (!engine) {
+        err << "srs_simulator: " << error << Qt::endl;
+        return 1;
+    }
+
+    QFile outputFile;
+    if (parser.isSet("output")) {
+        outputFile.setFileName(parser.value("output"));
+        if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+            err << "srs_simulator: cannot write " << outputFile.fileName() << ": "
+                << outputFile.errorString() << Qt::endl;
+            return 1;
+        }
+    } else {
+        outputFile.open(stdout, QIODevice::WriteOnly | QIODevice::Text);
+    }
+    QTextStream out(&outputFile);
+
+    QThreadPool pool;
+    if (threads > 0) {
+        pool.setMaxThreadCount(threads);
+    }
+
+    // ========== Learners ==========
+    QSharedPointer<Clock> clock = QSharedPointer<Clock>::create();
+    clock->setToday(QDate::currentDate());
+
+    QVector<Learner*> learners;
+    learners.reserve(learnerCount);
+    for (int i = 0; i < learnerCount; ++i) {
+        // Spread the remainder so the learners add up to --items
+        const int share = itemCount / learnerCount + (i < itemCount % learnerCount ? 1 : 0);
+        Learner* learner = new Learner(i, share, clock, seed + static_cast<quint32>(i));
+        learner->scheduler.setEngine(engine);
+        learners.append(learner);
+    }
+
+    // ========== Simulation ==========
+    out << "day\tdate\tnewItems\treviews\tlapses\tschedulerMs\n";
+
+    DayStats total;
+    qint64 peakReviews = 0;
+    QElapsedTimer wallTimer;
+    wallTimer.start();
+
+    for (int day = 0; day < days; ++day) {
+        QtConcurrent::blockingMap(&pool, learners, [&model, newPerDay](Learner* learner) {
+            learner->simulateDay(model, newPerDay);
+        });
+
+        DayStats dayStats;
+        for (const Learner* learner : learners) {
+            dayStats.add(learner->today);
+        }
+        total.add(dayStats);
+        peakReviews = std::max(peakReviews, dayStats.reviews);
+
+        out << day << '\t' << clock->today().toString(Qt::ISODate) << '\t' << dayStats.newItems << '\t'
+            << dayStats.reviews << '\t' << dayStats.lapses << '\t'
+            << QString::number(dayStats.schedulerNs / 1e6, 'f', 2) << '\n';
+
+        clock->advance(1);
+    }
+    out.flush();
+
+    const double wallMs = wallTimer.nsecsElapsed() / 1e6;
+    qDeleteAll(learners);
+
+    // ========== Summary ==========
+    const double meanReviews = days > 0 ? double(total.reviews) / days : 0.0;
+    const double nsPerCall = (total.reviews + total.newItems) > 0
+        ? double(total.schedulerNs) / (total.reviews + total.newItems) : 0.0;
+    err << "srs_simulator: " << engine->name() << ", " << learnerCount << " learners, " << total.newItems
+        << " items learned over " << days << " days" << Qt::endl;
+    err << "srs_simulator: " << total.reviews << " reviews (" << QString::number(meanReviews, 'f', 1)
+        << " per day, peak " << peakReviews << "), lapse rate "
+        << QString::number(total.reviews > 0 ? double(total.lapses) / total.reviews : 0.0, 'f', 3) << Qt::endl;
+    err << "srs_simulator: scheduler time " << QString::number(total.schedulerNs / 1e6, 'f', 1) << " ms ("
+        << QString::number(nsPerCall / 1000.0, 'f', 2) << " us per scheduled item), wall "
+        << QString::number(wallMs, 'f', 1) << " ms on " << pool.maxThreadCount() << " threads" << Qt::endl;
+    return 0;
+}
@@ -0,0 +1,10 @@
+QT       = core concurrent
+CONFIG  += c++17 console
+CONFIG  -= app_bundle
+
+TARGET = srs_simulator
+
+include(../../core.pri)
+
+SOURCES += \
+    main.cpp